@@ -0,0 +1,28 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// counts heap allocations of the whole benchmark binary
+static std::atomic<std::size_t> allocations{0};
+
+void* operator new(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {  // NOLINT
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+// pairs with the malloc above, which GCC cannot see through inlined deletes
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete(void* ptr) noexcept { std::free(ptr); }  // NOLINT
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);  // NOLINT
+}
+#pragma GCC diagnostic pop
+
+std::size_t allocation_count() { return allocations.load(); }
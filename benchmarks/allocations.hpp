@@ -0,0 +1,11 @@
+#ifndef BOALANG_BENCHMARK_ALLOCATIONS_HPP
+#define BOALANG_BENCHMARK_ALLOCATIONS_HPP
+
+#include <cstddef>
+
+/**
+ * @return Number of heap allocations made by the benchmark binary so far.
+ */
+std::size_t allocation_count();
+
+#endif  // BOALANG_BENCHMARK_ALLOCATIONS_HPP
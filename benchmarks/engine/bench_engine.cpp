@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "../utils.hpp"
+#include "engine/engine.hpp"
+#include "utils/thread_pool.hpp"
+
+static const std::string SMALL_SCRIPT = R"(
+int fib(int n) {
+  mut int a = 0;
+  mut int b = 1;
+  mut int i = 0;
+  while (i < n) {
+    int t = a + b;
+    a = b;
+    b = t;
+    i = i + 1;
+  }
+  return a;
+}
+print scale(fib(20));
+)";
+
+static void register_scale(boalang::Engine& engine) {
+  engine.register_function("scale", INT, {INT},
+                           [](const std::vector<boalang::Value>& args) {
+                             return boalang::Value(std::get<int>(args[0]) / 2);
+                           });
+}
+
+static void BM_EngineRun(benchmark::State& state) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  register_scale(engine);
+  auto script = boalang::Engine::compile(SMALL_SCRIPT);
+  for (auto _ : state) {
+    engine.run(script);
+    out.str({});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EngineRun);
+
+static void BM_EngineCompileAndRun(benchmark::State& state) {
+  std::ostringstream out;
+  for (auto _ : state) {
+    boalang::Engine engine(out);
+    register_scale(engine);
+    engine.run(boalang::Engine::compile(SMALL_SCRIPT));
+    out.str({});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EngineCompileAndRun);
+
+static void BM_EngineParallelRuns(benchmark::State& state) {
+  constexpr int RUNS = 256;
+  auto threads = static_cast<std::size_t>(state.range(0));
+  auto script = boalang::Engine::compile(SMALL_SCRIPT);
+  ThreadPool pool(threads);
+  for (auto _ : state) {
+    std::vector<std::future<void>> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+      workers.push_back(pool.submit([&script, threads] {
+        std::ostringstream out;
+        boalang::Engine engine(out);
+        register_scale(engine);
+        for (std::size_t run = 0; run < RUNS / threads; ++run) {
+          engine.run(script);
+          out.str({});
+        }
+      }));
+    }
+    for (auto& worker : workers) {
+      worker.get();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * RUNS);
+}
+BENCHMARK(BM_EngineParallelRuns)
+    ->RangeMultiplier(2)
+    ->Range(1, std::max(2U, std::thread::hardware_concurrency()))
+    ->UseRealTime();
@@ -0,0 +1,95 @@
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "../utils.hpp"
+#include "engine/engine.hpp"
+
+static const std::string SPIN = R"(
+mut int i = 0;
+while (true) {
+  i = i + 1;
+}
+)";
+
+// every resume runs given number of loop steps and switches stacks twice
+static void BM_TaskResume(benchmark::State& state) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = static_cast<std::uint64_t>(state.range(0));
+  auto task = engine.start(boalang::Engine::compile(SPIN), out);
+  for (auto _ : state) {
+    task->resume();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TaskResume)->RangeMultiplier(16)->Range(1, 4096);
+
+// same steps run without suspending, for comparison
+static void BM_EngineSpin(benchmark::State& state) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().max_steps = static_cast<std::uint64_t>(state.range(0));
+  auto script = boalang::Engine::compile(SPIN);
+  for (auto _ : state) {
+    try {
+      engine.run(script);
+    } catch (const RuntimeError&) {
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EngineSpin)->RangeMultiplier(16)->Range(1, 4096);
+
+static std::size_t resident_bytes() {
+  std::size_t pages = 0;
+  std::size_t resident = 0;
+  std::ifstream("/proc/self/statm") >> pages >> resident;
+  return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+static const std::string IDLE = R"(
+struct Item {int id; str name;}
+int wait(int depth) {
+  Item item = {depth, "item with a name too long to be inline"};
+  if (depth > 0) {
+    return wait(depth - 1) + 1;
+  }
+  mut int i = 0;
+  while (true) {
+    i = i + item.id;
+  }
+  return i;
+}
+wait(4);
+)";
+
+// resident memory of many tasks suspended in a call nest
+static void BM_SuspendedTaskMemory(benchmark::State& state) {
+  auto count = static_cast<std::size_t>(state.range(0));
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 16;
+  auto script = boalang::Engine::compile(IDLE);
+  std::size_t resident = 0;
+  std::size_t charged = 0;
+  for (auto _ : state) {
+    std::vector<std::unique_ptr<boalang::Task>> tasks;
+    tasks.reserve(count);
+    std::size_t before = resident_bytes();
+    for (std::size_t i = 0; i < count; ++i) {
+      tasks.push_back(engine.start(script, out));
+      tasks.back()->resume();
+    }
+    resident = resident_bytes() - before;
+    charged = tasks.back()->interpreter().memory().live();
+  }
+  state.counters["resident_bytes_per_task"] =
+      static_cast<double>(resident) / static_cast<double>(count);
+  state.counters["charged_bytes_per_task"] = static_cast<double>(charged);
+}
+BENCHMARK(BM_SuspendedTaskMemory)
+    ->Arg(1000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,37 @@
+#include "../utils.hpp"
+
+static std::string arithmetic_loop(const std::string& type,
+                                   const std::string& zero,
+                                   const std::string& one, int64_t iterations) {
+  return "mut " + type + " acc = " + zero + ";\n" +
+         "mut int i = 0;\n"
+         "while (i < " +
+         std::to_string(iterations) +
+         ") {\n"
+         "  acc = acc + " +
+         one + " * " + one + " - " + one + " + " + one +
+         ";\n"
+         "  i = i + 1;\n"
+         "}\n";
+}
+
+static void BM_IntArithmeticLoop(benchmark::State& state) {
+  auto program = get_ast(arithmetic_loop("int", "0", "3", state.range(0)));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  // every iteration performs 5 additive/multiplicative operations
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 5);
+}
+BENCHMARK(BM_IntArithmeticLoop)->Arg(10000);
+
+static void BM_FloatArithmeticLoop(benchmark::State& state) {
+  auto program =
+      get_ast(arithmetic_loop("float", "0.0", "1.5", state.range(0)));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  // 4 float operations and 1 int increment per iteration
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 5);
+}
+BENCHMARK(BM_FloatArithmeticLoop)->Arg(10000);
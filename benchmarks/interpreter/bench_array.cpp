@@ -0,0 +1,43 @@
+#include "../utils.hpp"
+
+static std::string fill(int elements) {
+  return "mut int[] a = {};\n"
+         "mut int i = 0;\n"
+         "while (i < " +
+         std::to_string(elements) +
+         ") {\n"
+         "  push(a, i / 1000);\n"
+         "  i = i + 1;\n"
+         "}\n"
+         "mut int sum = 0;\n";
+}
+
+static void bench_program(benchmark::State& state, const std::string& code) {
+  auto program = get_ast(fill(static_cast<int>(state.range(0))) + code);
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ArrayPush(benchmark::State& state) { bench_program(state, ""); }
+BENCHMARK(BM_ArrayPush)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// both sums include the fill measured by BM_ArrayPush
+static void BM_ArrayIndexSum(benchmark::State& state) {
+  bench_program(state,
+                "i = 0;\n"
+                "while (i < size(a)) {\n"
+                "  sum = sum + a[i];\n"
+                "  i = i + 1;\n"
+                "}\n");
+}
+BENCHMARK(BM_ArrayIndexSum)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_ArrayForSum(benchmark::State& state) {
+  bench_program(state,
+                "for (int x in a) {\n"
+                "  sum = sum + x;\n"
+                "}\n");
+}
+BENCHMARK(BM_ArrayForSum)->Arg(1000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,107 @@
+#include <optional>
+
+#include "../utils.hpp"
+#include "optimizer/inliner.hpp"
+
+static void bench_calls(benchmark::State& state, const std::string& func,
+                        const std::string& call, int repeats) {
+  auto program = get_ast(func +
+                         "mut int i = 0;\n"
+                         "while (i < " +
+                         std::to_string(repeats) +
+                         ") {\n"
+                         "  int result = " +
+                         call +
+                         ";\n"
+                         "  i = i + 1;\n"
+                         "}\n");
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * repeats);
+}
+
+static const std::string TAIL_SUM =
+    "int sum(int n, int acc) {\n"
+    "  if (n == 0) { return acc; }\n"
+    "  return sum(n - 1, acc + n);\n"
+    "}\n";
+
+static const std::string SUM =
+    "int sum(int n) {\n"
+    "  if (n == 0) { return 0; }\n"
+    "  return n + sum(n - 1);\n"
+    "}\n";
+
+// accumulator recursion, run in one frame
+static void BM_TailRecursion(benchmark::State& state) {
+  auto depth = std::to_string(state.range(0));
+  bench_calls(state, TAIL_SUM, "sum(" + depth + ", 0)", 100);
+}
+BENCHMARK(BM_TailRecursion)->Arg(45)->Arg(10000);
+
+// same sum with a frame per call, limited by maximum recursion depth
+static void BM_Recursion(benchmark::State& state) {
+  auto depth = std::to_string(state.range(0));
+  bench_calls(state, SUM, "sum(" + depth + ")", 100);
+}
+BENCHMARK(BM_Recursion)->Arg(45);
+
+static const std::string FIB =
+    "int fib(int n) {\n"
+    "  if (n < 2) { return n; }\n"
+    "  return fib(n - 1) + fib(n - 2);\n"
+    "}\n";
+
+static void bench_fib(benchmark::State& state,
+                      std::optional<std::size_t> memo_capacity) {
+  auto program = get_ast(FIB + "int result = fib(" +
+                         std::to_string(state.range(0)) + ");\n");
+  for (auto _ : state) {
+    Interpreter interpreter;
+    interpreter.memo_capacity() = memo_capacity;
+    interpreter.visit(*program);
+  }
+}
+
+// exponential number of calls
+static void BM_Fib(benchmark::State& state) { bench_fib(state, std::nullopt); }
+BENCHMARK(BM_Fib)->Arg(15)->Arg(20)->Unit(benchmark::kMicrosecond);
+
+// one call per argument, the rest served from cache
+static void BM_FibMemoized(benchmark::State& state) {
+  bench_fib(state, DEFAULT_MEMO_CAPACITY);
+}
+BENCHMARK(BM_FibMemoized)->Arg(15)->Arg(20)->Unit(benchmark::kMicrosecond);
+
+static void bench_helper(benchmark::State& state, bool inlined) {
+  auto program = get_ast(
+      "bool between(int v, int lo, int hi) {\n"
+      "  return v >= lo and v <= hi;\n"
+      "}\n"
+      "mut int count = 0;\n"
+      "for (int i in 0.." +
+      std::to_string(state.range(0)) +
+      ") {\n"
+      "  if (between(i, 10, 20)) { count = count + 1; }\n"
+      "}\n");
+  if (inlined) {
+    inline_calls(*program);
+  }
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// small helper called in a loop
+static void BM_HelperCall(benchmark::State& state) {
+  bench_helper(state, false);
+}
+BENCHMARK(BM_HelperCall)->Arg(10000);
+
+// same helper evaluated in place of the call
+static void BM_HelperCallInlined(benchmark::State& state) {
+  bench_helper(state, true);
+}
+BENCHMARK(BM_HelperCallInlined)->Arg(10000);
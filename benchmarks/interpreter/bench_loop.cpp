@@ -0,0 +1,52 @@
+#include "../allocations.hpp"
+#include "../utils.hpp"
+
+static void bench_loop(benchmark::State& state, const std::string& code) {
+  auto program = get_ast(code);
+  std::size_t before = allocation_count();
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["allocs_per_iteration"] =
+      static_cast<double>(allocation_count() - before) /
+      static_cast<double>(state.iterations() * state.range(0));
+}
+
+static void BM_WhileCountedLoop(benchmark::State& state) {
+  bench_loop(state,
+             "mut int acc = 0;\n"
+             "mut int i = 0;\n"
+             "while (i < " +
+                 std::to_string(state.range(0)) +
+                 ") {\n"
+                 "  acc = acc + i;\n"
+                 "  i = i + 1;\n"
+                 "}\n");
+}
+BENCHMARK(BM_WhileCountedLoop)->Arg(10000);
+
+static void BM_WhileDeclaringLoop(benchmark::State& state) {
+  bench_loop(state,
+             "mut int acc = 0;\n"
+             "mut int i = 0;\n"
+             "while (i < " +
+                 std::to_string(state.range(0)) +
+                 ") {\n"
+                 "  int next = acc + i;\n"
+                 "  acc = next;\n"
+                 "  i = i + 1;\n"
+                 "}\n");
+}
+BENCHMARK(BM_WhileDeclaringLoop)->Arg(10000);
+
+static void BM_ForRangeLoop(benchmark::State& state) {
+  bench_loop(state,
+             "mut int acc = 0;\n"
+             "for (int i in 0.." +
+                 std::to_string(state.range(0)) +
+                 ") {\n"
+                 "  acc = acc + i;\n"
+                 "}\n");
+}
+BENCHMARK(BM_ForRangeLoop)->Arg(10000);
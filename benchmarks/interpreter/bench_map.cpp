@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "../utils.hpp"
+#include "interpreter/hashmap/hashmap.hpp"
+
+static std::vector<int> random_keys(std::size_t count) {
+  std::mt19937 random(42);
+  std::vector<int> keys(count);
+  for (auto& key : keys) {
+    key = static_cast<int>(random());
+  }
+  return keys;
+}
+
+static void BM_HashMapInsert(benchmark::State& state) {
+  auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    HashMap<int> map;
+    for (int key : keys) {
+      map.insert_or_assign(key, key);
+    }
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashMapInsert)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_HashMapFind(benchmark::State& state) {
+  auto keys = random_keys(static_cast<std::size_t>(state.range(0)));
+  HashMap<int> map;
+  for (int key : keys) {
+    map.insert_or_assign(key, key);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+  for (auto _ : state) {
+    long sum = 0;
+    for (int key : keys) {
+      sum += *map.find(key);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HashMapFind)
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 22)
+    ->Unit(benchmark::kMillisecond);
+
+static std::string lookup_loop(int lookups, int keys) {
+  return "mut int acc = 0;\n"
+         "mut int i = 0;\n"
+         "while (i < " +
+         std::to_string(lookups) +
+         ") {\n"
+         "  acc = acc + lookup(i - i / " +
+         std::to_string(keys) + " * " + std::to_string(keys) +
+         ");\n"
+         "  i = i + 1;\n"
+         "}\n";
+}
+
+// lookup table written as an if/else chain, as before maps existed
+static void BM_IfChainLookup(benchmark::State& state) {
+  int keys = static_cast<int>(state.range(0));
+  std::string code = "int lookup(int key) {\n";
+  for (int key = 0; key < keys; ++key) {
+    code += "  if (key == " + std::to_string(key) + ") { return " +
+            std::to_string(key * 3) + "; }\n";
+  }
+  code += "  return 0;\n}\n";
+  auto program = get_ast(code + lookup_loop(1 << 12, keys));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * (1 << 12));
+}
+BENCHMARK(BM_IfChainLookup)->RangeMultiplier(4)->Range(4, 256);
+
+static void BM_MapLookup(benchmark::State& state) {
+  int keys = static_cast<int>(state.range(0));
+  std::string code = "mut int[int] table = {};\n";
+  for (int key = 0; key < keys; ++key) {
+    code += "table[" + std::to_string(key) + "] = " + std::to_string(key * 3) +
+            ";\n";
+  }
+  code += "int lookup(int key) { return table[key]; }\n";
+  auto program = get_ast(code + lookup_loop(1 << 12, keys));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * (1 << 12));
+}
+BENCHMARK(BM_MapLookup)->RangeMultiplier(4)->Range(4, 256);
+
+static void BM_MapScriptFill(benchmark::State& state) {
+  auto program = get_ast(
+      "mut int[int] m = {};\n"
+      "mut int i = 0;\n"
+      "while (i < " +
+      std::to_string(state.range(0)) +
+      ") {\n"
+      "  m[i * 3] = i;\n"
+      "  i = i + 1;\n"
+      "}\n");
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MapScriptFill)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
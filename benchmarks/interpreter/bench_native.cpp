@@ -0,0 +1,55 @@
+#include <sstream>
+
+#include "../utils.hpp"
+#include "engine/engine.hpp"
+
+static std::string call_loop(int calls) {
+  return "str s = \"0123456789012345678901234567890123456789\";\n"
+         "mut int acc = 0;\n"
+         "mut int i = 0;\n"
+         "while (i < " +
+         std::to_string(calls) +
+         ") {\n"
+         "  acc = acc + size(s);\n"
+         "  i = i + 1;\n"
+         "}\n";
+}
+
+static void BM_NativeTypedCall(benchmark::State& state) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  engine.register_native(
+      "size", [](std::string_view s) { return static_cast<int>(s.size()); });
+  auto script = boalang::Engine::compile(call_loop(state.range(0)));
+  for (auto _ : state) {
+    engine.run(script);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NativeTypedCall)->Arg(1 << 12);
+
+static void BM_NativeValueCall(benchmark::State& state) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  engine.register_function(
+      "size", INT, {STR}, [](const std::vector<boalang::Value>& args) {
+        return boalang::Value(
+            static_cast<int>(std::get<std::string>(args[0]).size()));
+      });
+  auto script = boalang::Engine::compile(call_loop(state.range(0)));
+  for (auto _ : state) {
+    engine.run(script);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NativeValueCall)->Arg(1 << 12);
+
+static void BM_BoalangCall(benchmark::State& state) {
+  auto program =
+      get_ast("int size(str s) { return 40; }\n" + call_loop(state.range(0)));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BoalangCall)->Arg(1 << 12);
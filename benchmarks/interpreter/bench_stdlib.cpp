@@ -0,0 +1,72 @@
+#include "../utils.hpp"
+
+// pure boalang equivalents of standard library functions
+static const std::string BOALANG_LIBRARY = R"(
+int abs_(int a) {
+  if (a < 0) { return 0 - a; }
+  return a;
+}
+int max_(int a, int b) {
+  if (a > b) { return a; }
+  return b;
+}
+float pow_(float base, float exponent) {
+  mut float result = 1.0;
+  mut float k = 0.0;
+  while (k < exponent) {
+    result = result * base;
+    k = k + 1.0;
+  }
+  return result;
+}
+float sqrt_(float value) {
+  mut float x = value;
+  mut int k = 0;
+  while (k < 20) {
+    x = (x + value / x) / 2.0;
+    k = k + 1;
+  }
+  return x;
+}
+)";
+
+static std::string call_loop(int calls, const std::string& call) {
+  return "mut float acc = 0.0;\n"
+         "mut int i = 0;\n"
+         "while (i < " +
+         std::to_string(calls) +
+         ") {\n"
+         "  acc = acc + " +
+         call +
+         ";\n"
+         "  i = i + 1;\n"
+         "}\n";
+}
+
+static void bench_calls(benchmark::State& state, const std::string& call,
+                        bool native) {
+  std::string suffix = native ? "" : "_";
+  auto program = get_ast(BOALANG_LIBRARY +
+                         call_loop(static_cast<int>(state.range(0)),
+                                   call.substr(0, call.find('(')) + suffix +
+                                       call.substr(call.find('('))));
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_StdlibAbsMax(benchmark::State& state) {
+  bench_calls(state, "max(abs(i - 100), 7) as float", state.range(1) != 0);
+}
+BENCHMARK(BM_StdlibAbsMax)->Args({1 << 10, 0})->Args({1 << 10, 1});
+
+static void BM_StdlibPow(benchmark::State& state) {
+  bench_calls(state, "pow(1.01, 32.0)", state.range(1) != 0);
+}
+BENCHMARK(BM_StdlibPow)->Args({1 << 10, 0})->Args({1 << 10, 1});
+
+static void BM_StdlibSqrt(benchmark::State& state) {
+  bench_calls(state, "sqrt(2.0)", state.range(1) != 0);
+}
+BENCHMARK(BM_StdlibSqrt)->Args({1 << 10, 0})->Args({1 << 10, 1});
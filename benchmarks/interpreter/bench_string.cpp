@@ -0,0 +1,22 @@
+#include "../utils.hpp"
+
+static void BM_StringAccumulation(benchmark::State& state) {
+  auto program = get_ast(
+      "mut str s = \"\";\n"
+      "mut int i = 0;\n"
+      "while (i < " +
+      std::to_string(state.range(0)) +
+      ") {\n"
+      "  s = s + \"0123456789\";\n"
+      "  i = i + 1;\n"
+      "}\n");
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetComplexityN(state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 10);
+}
+BENCHMARK(BM_StringAccumulation)
+    ->RangeMultiplier(4)
+    ->Range(1 << 8, 1 << 14)
+    ->Complexity();
@@ -0,0 +1,61 @@
+#include "../allocations.hpp"
+#include "../utils.hpp"
+#include "optimizer/optimizer.hpp"
+
+static void bench_struct(benchmark::State& state, const std::string& code) {
+  // optimized like by the interpreter binary, which finds local lists
+  auto program = get_ast(code);
+  optimize(*program);
+  std::size_t before = allocation_count();
+  for (auto _ : state) {
+    interpret(*program);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["allocs_per_iteration"] =
+      static_cast<double>(allocation_count() - before) /
+      static_cast<double>(state.iterations() * state.range(0));
+}
+
+static void BM_StructInLoop(benchmark::State& state) {
+  bench_struct(state,
+               "struct P {int x; int y;}\n"
+               "mut int acc = 0;\n"
+               "for (int i in 0.." +
+                   std::to_string(state.range(0)) +
+                   ") {\n"
+                   "  P p = {i, i + 1};\n"
+                   "  acc = acc + p.y - p.x;\n"
+                   "}\n");
+}
+BENCHMARK(BM_StructInLoop)->Arg(10000);
+
+static void BM_NestedStructInLoop(benchmark::State& state) {
+  bench_struct(state,
+               "struct P {int x; int y;}\n"
+               "struct L {P from; P to;}\n"
+               "mut int acc = 0;\n"
+               "for (int i in 0.." +
+                   std::to_string(state.range(0)) +
+                   ") {\n"
+                   "  P from = {i, i};\n"
+                   "  P to = {i + 1, i + 2};\n"
+                   "  L line = {from, to};\n"
+                   "  acc = acc + line.to.x - line.from.y;\n"
+                   "}\n");
+}
+BENCHMARK(BM_NestedStructInLoop)->Arg(10000);
+
+static void BM_VariantFieldInLoop(benchmark::State& state) {
+  bench_struct(state,
+               "variant V {int, float};\n"
+               "struct S {V value; int weight;}\n"
+               "mut int acc = 0;\n"
+               "for (int i in 0.." +
+                   std::to_string(state.range(0)) +
+                   ") {\n"
+                   "  V v = i;\n"
+                   "  S s = {v, 2};\n"
+                   "  acc = acc + (s.value as int) * s.weight;\n"
+                   "}\n");
+}
+BENCHMARK(BM_VariantFieldInLoop)->Arg(10000);
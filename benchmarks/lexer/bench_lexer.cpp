@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <thread>
+
+#include "../utils.hpp"
+#include "lexer/parallel_lexer.hpp"
+
+static std::string generate_commented_source(int lines) {
+  std::string code;
+  for (int i = 0; i < lines; ++i) {
+    code +=
+        "/* block comment describing the declaration below,\n"
+        "   spread over a couple of lines */\n";
+    code += "        mut int x" + std::to_string(i) +
+            " = 42;    // trailing comment with some words in it\n";
+    code += "        print \"a moderately long string literal\";\n\n";
+  }
+  return code;
+}
+
+static void BM_LexCommentHeavy(benchmark::State& state) {
+  std::string code =
+      generate_commented_source(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    StringSource source(code);
+    benchmark::DoNotOptimize(Lexer(source).tokenize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_LexCommentHeavy)->Arg(10000)->Arg(100000);
+
+static void BM_LexParallel(benchmark::State& state) {
+  std::string code = generate_commented_source(100000);
+  ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ParallelLexer(code, pool).tokenize());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_LexParallel)
+    ->DenseRange(1, std::max(2U, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
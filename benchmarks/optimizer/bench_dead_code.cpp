@@ -0,0 +1,60 @@
+#include <sstream>
+
+#include "../utils.hpp"
+#include "optimizer/dead_code.hpp"
+
+/**
+ * @brief Generates a program like the generated scripts, defining \p unused
+ * functions and types for a short computation using few of them.
+ */
+static std::string generate_unused(int unused) {
+  std::string code;
+  for (int i = 0; i < unused; ++i) {
+    std::string n = std::to_string(i);
+    code += "struct Record" + n + " {int id; str name; float score;}\n";
+    code += "int handler" + n + "(Record" + n + " record, int limit) {\n";
+    code += "  mut int acc = record.id;\n";
+    code += "  while (acc < limit) {\n";
+    code += "    acc = acc * 2 + handler" + n + "(record, acc);\n";
+    code += "  }\n";
+    code += "  return acc;\n";
+    code += "}\n";
+  }
+  code += "int twice(int v) {\n";
+  code += "  return v * 2;\n";
+  code += "  print \"unreachable\";\n";
+  code += "}\n";
+  code += "print twice(21);\n";
+  return code;
+}
+
+// parsed, optimized and run like by the interpreter binary
+static void bench_large_program(benchmark::State& state, bool prune) {
+  std::string code = generate_unused(static_cast<int>(state.range(0)));
+  std::ostringstream out;
+  std::size_t peak = 0;
+  std::size_t statements = 0;
+  for (auto _ : state) {
+    auto program = get_ast(code);
+    if (prune) {
+      remove_unreachable_statements(*program);
+      remove_unused_declarations(*program);
+    }
+    Interpreter interpreter(out);
+    interpreter.visit(*program);
+    peak = interpreter.memory().peak();
+    statements = program->statements.size();
+  }
+  state.counters["peak_bytes"] = static_cast<double>(peak);
+  state.counters["statements"] = static_cast<double>(statements);
+}
+
+static void BM_StartLargeProgram(benchmark::State& state) {
+  bench_large_program(state, false);
+}
+BENCHMARK(BM_StartLargeProgram)->Arg(2000)->Unit(benchmark::kMillisecond);
+
+static void BM_StartLargeProgramPruned(benchmark::State& state) {
+  bench_large_program(state, true);
+}
+BENCHMARK(BM_StartLargeProgramPruned)->Arg(2000)->Unit(benchmark::kMillisecond);
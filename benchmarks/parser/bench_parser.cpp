@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <thread>
+
+#include "../utils.hpp"
+#include "parser/incremental_parser.hpp"
+#include "parser/parallel_parser.hpp"
+
+static void BM_ParseProgram(benchmark::State& state) {
+  std::string code = generate_program(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(get_ast(code));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_ParseProgram)->Arg(1000)->Arg(5600);
+
+static void BM_ParseExpressions(benchmark::State& state) {
+  std::string code;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    code += "bool v" + std::to_string(i) +
+            " = a * b + c / d - (e - f) * g < h and i == -j or !k is bool;\n";
+  }
+  StringSource source(code);
+  std::vector<Token> tokens = Lexer(source).tokenize();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Parser(tokens).parse());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_ParseExpressions)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseProgramStreaming(benchmark::State& state) {
+  std::string code = generate_program(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    StringSource source(code);
+    Lexer lexer(source);
+    LexerCommentFilter filter(lexer);
+    Parser parser(filter);
+    benchmark::DoNotOptimize(parser.parse());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_ParseProgramStreaming)->Arg(1000);
+
+static void BM_ParseParallel(benchmark::State& state) {
+  std::string code = generate_program(20000);
+  StringSource source(code);
+  std::vector<Token> tokens = Lexer(source).tokenize();
+  ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ParallelParser(tokens, pool).parse());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_ParseParallel)
+    ->DenseRange(1, std::max(2U, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_ReparseEdit(benchmark::State& state) {
+  std::string code = generate_program(5600);  // ~50k lines
+  IncrementalParser parser(code);
+  auto program = parser.parse();
+  // edit in the middle, optionally adding a line shifting all that follows
+  std::string original = "return acc;";
+  std::string edited = state.range(0) ? "\n  return acc + 1;" : "return acc+1;";
+  std::size_t offset = code.find(original, code.size() / 2);
+  for (auto _ : state) {
+    parser.reparse(*program, {offset, original.size(), edited});
+    parser.reparse(*program, {offset, edited.size(), original});
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_ReparseEdit)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
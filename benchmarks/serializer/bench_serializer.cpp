@@ -0,0 +1,13 @@
+#include "../utils.hpp"
+#include "serializer/serializer.hpp"
+
+static void BM_DeserializeProgram(benchmark::State& state) {
+  std::string code = generate_program(static_cast<int>(state.range(0)));
+  std::string data = ASTSerializer::serialize(*get_ast(code), 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ASTDeserializer::deserialize(data, 0));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(code.size()));
+}
+BENCHMARK(BM_DeserializeProgram)->Arg(1000);
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "interpreter/interpreter.hpp"
+#include "lexer/lexer.hpp"
+#include "parser/parser.hpp"
+
+inline static std::unique_ptr<Program> get_ast(const std::string& code) {
+  StringSource source(code);
+  Parser parser(Lexer(source).tokenize());
+  return parser.parse();
+}
+
+inline static std::string generate_program(int functions) {
+  std::string code;
+  for (int i = 0; i < functions; ++i) {
+    std::string n = std::to_string(i);
+    code += "int f" + n + "(int a, int b) {\n";
+    code += "  mut int acc = a;\n";
+    code += "  while (acc < b * " + n + ") {\n";
+    code += "    if (acc == 3 or acc > 100) { acc = acc + 2; }\n";
+    code += "    else { acc = acc * 2 + 1; }\n";
+    code += "  }\n";
+    code += "  return acc;\n";
+    code += "}\n";
+    code += "print f" + n + "(1, 2);\n";
+  }
+  return code;
+}
+
+inline static void interpret(const Program& program) {
+  Interpreter interpreter;
+  interpreter.visit(program);
+}
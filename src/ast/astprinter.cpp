@@ -70,6 +70,28 @@ void ASTPrinter::visit(const WhileStmt& stmt) {
   parenthesize({stmt.body.get()});
 }
 
+void ASTPrinter::visit(const ForStmt& stmt) {
+  print_memory_info("ForStmt", &stmt);
+  std::cout << ' ';
+  visit_type(stmt.type);
+  std::cout << " {" << stmt.identifier << "}";
+  std::cout << "\nIterable:";
+  parenthesize({stmt.iterable.get()});
+  std::cout << "\nBody:";
+  parenthesize({stmt.body.get()});
+}
+
+void ASTPrinter::visit(const ForRangeStmt& stmt) {
+  print_memory_info("ForRangeStmt", &stmt);
+  std::cout << " {" << stmt.identifier << "}";
+  std::cout << "\nBegin:";
+  parenthesize({stmt.begin.get()});
+  std::cout << "\nEnd:";
+  parenthesize({stmt.end.get()});
+  std::cout << "\nBody:";
+  parenthesize({stmt.body.get()});
+}
+
 void ASTPrinter::visit(const PrintStmt& stmt) {
   print_memory_info("PrintStmt", &stmt);
   parenthesize({stmt.expr.get()});
@@ -301,11 +323,29 @@ void ASTPrinter::visit(const FieldAccessExpr& expr) {
   std::cout << expr.field_name;
 }
 
+void ASTPrinter::visit(const IndexExpr& expr) {
+  print_memory_info("IndexExpr", &expr);
+  std::cout << "\nArray:";
+  parenthesize({expr.array.get()});
+  std::cout << "\nIndex:";
+  parenthesize({expr.index.get()});
+}
+
 void ASTPrinter::visit_type(const VarType& type) {
   switch (type.type) {
     case IDENTIFIER:
       std::cout << type.name;
       break;
+    case ARRAY:
+      visit_type(*type.element);
+      std::cout << "[]";
+      break;
+    case MAP:
+      visit_type(*type.element);
+      std::cout << "[";
+      visit_type(*type.key);
+      std::cout << "]";
+      break;
     default:
       std::cout << std::string(magic_enum::enum_name(type.type));
       break;
@@ -37,6 +37,8 @@ class ASTPrinter : public ExprVisitor, public StmtVisitor {
   void visit(const IfStmt& stmt) override;
   void visit(const BlockStmt& stmt) override;
   void visit(const WhileStmt& stmt) override;
+  void visit(const ForStmt& stmt) override;
+  void visit(const ForRangeStmt& stmt) override;
   void visit(const VarDeclStmt& stmt) override;
   void visit(const StructFieldStmt& stmt) override;
   void visit(const StructDeclStmt& stmt) override;
@@ -71,6 +73,7 @@ class ASTPrinter : public ExprVisitor, public StmtVisitor {
   void visit(const InitalizerListExpr& expr) override;
   void visit(const CallExpr& expr) override;
   void visit(const FieldAccessExpr& expr) override;
+  void visit(const IndexExpr& expr) override;
 };
 
 #endif  // BOALANG_ASTPRINTER_HPP
@@ -0,0 +1,262 @@
+#include "astwalker.hpp"
+
+namespace {
+
+// Children of every node in the order both walkers visit them. Pointers held
+// by nodes are not const even in const nodes, so the same overloads serve
+// both walkers.
+
+template <typename F>
+void for_each_child(const Program& stmt, F&& f) {
+  for (const auto& s : stmt.statements) {
+    f(s.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const PrintStmt& stmt, F&& f) {
+  f(stmt.expr.get());
+}
+
+template <typename F>
+void for_each_child(const IfStmt& stmt, F&& f) {
+  f(stmt.condition.get());
+  f(stmt.then_branch.get());
+  f(stmt.else_branch.get());
+}
+
+template <typename F>
+void for_each_child(const BlockStmt& stmt, F&& f) {
+  for (const auto& s : stmt.statements) {
+    f(s.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const WhileStmt& stmt, F&& f) {
+  f(stmt.condition.get());
+  f(stmt.body.get());
+}
+
+template <typename F>
+void for_each_child(const ForStmt& stmt, F&& f) {
+  f(stmt.iterable.get());
+  f(stmt.body.get());
+}
+
+template <typename F>
+void for_each_child(const ForRangeStmt& stmt, F&& f) {
+  f(stmt.begin.get());
+  f(stmt.end.get());
+  f(stmt.body.get());
+}
+
+template <typename F>
+void for_each_child(const VarDeclStmt& stmt, F&& f) {
+  f(stmt.initializer.get());
+}
+
+template <typename F>
+void for_each_child(const StructFieldStmt&, F&&) {}
+
+template <typename F>
+void for_each_child(const StructDeclStmt& stmt, F&& f) {
+  for (const auto& field : stmt.fields) {
+    f(field.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const VariantDeclStmt&, F&&) {}
+
+template <typename F>
+void for_each_child(const AssignStmt& stmt, F&& f) {
+  f(stmt.var.get());
+  f(stmt.value.get());
+}
+
+template <typename F>
+void for_each_child(const CallStmt& stmt, F&& f) {
+  for (const auto& arg : stmt.arguments) {
+    f(arg.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const FuncParamStmt&, F&&) {}
+
+template <typename F>
+void for_each_child(const FuncStmt& stmt, F&& f) {
+  for (const auto& param : stmt.params) {
+    f(param.get());
+  }
+  f(stmt.body.get());
+}
+
+template <typename F>
+void for_each_child(const ReturnStmt& stmt, F&& f) {
+  f(stmt.value.get());
+}
+
+template <typename F>
+void for_each_child(const LambdaFuncStmt& stmt, F&& f) {
+  f(stmt.body.get());
+}
+
+template <typename F>
+void for_each_child(const InspectStmt& stmt, F&& f) {
+  f(stmt.inspected.get());
+  for (const auto& lambda : stmt.lambdas) {
+    f(lambda.get());
+  }
+  f(stmt.default_lambda.get());
+}
+
+template <typename Derived, typename F>
+void for_each_child(const BinaryExpr<Derived>& expr, F&& f) {
+  f(expr.left.get());
+  f(expr.right.get());
+}
+
+template <typename Derived, typename F>
+void for_each_child(const LogicalExpr<Derived>& expr, F&& f) {
+  f(expr.left.get());
+  f(expr.right.get());
+}
+
+template <typename F>
+void for_each_child(const GroupingExpr& expr, F&& f) {
+  f(expr.expr.get());
+}
+
+template <typename F>
+void for_each_child(const LiteralExpr&, F&&) {}
+
+template <typename F>
+void for_each_child(const NegationExpr& expr, F&& f) {
+  f(expr.right.get());
+}
+
+template <typename F>
+void for_each_child(const LogicalNegationExpr& expr, F&& f) {
+  f(expr.right.get());
+}
+
+template <typename F>
+void for_each_child(const VarExpr&, F&&) {}
+
+template <typename F>
+void for_each_child(const IsTypeExpr& expr, F&& f) {
+  f(expr.left.get());
+}
+
+template <typename F>
+void for_each_child(const AsTypeExpr& expr, F&& f) {
+  f(expr.left.get());
+}
+
+template <typename F>
+void for_each_child(const InitalizerListExpr& expr, F&& f) {
+  for (const auto& item : expr.list) {
+    f(item.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const CallExpr& expr, F&& f) {
+  for (const auto& arg : expr.arguments) {
+    f(arg.get());
+  }
+}
+
+template <typename F>
+void for_each_child(const FieldAccessExpr& expr, F&& f) {
+  f(expr.parent_struct.get());
+}
+
+template <typename F>
+void for_each_child(const IndexExpr& expr, F&& f) {
+  f(expr.array.get());
+  f(expr.index.get());
+}
+
+}  // namespace
+
+void ASTWalker::walk(const Expr* expr) {
+  if (expr) {
+    expr->accept(*this);
+  }
+}
+
+void ASTWalker::walk(const Stmt* stmt) {
+  if (stmt) {
+    stmt->accept(*this);
+  }
+}
+
+void MutableASTWalker::walk(Expr* expr) {
+  if (expr) {
+    expr->accept(*this);
+  }
+}
+
+void MutableASTWalker::walk(Stmt* stmt) {
+  if (stmt) {
+    stmt->accept(*this);
+  }
+}
+
+#define VISIT(type)                                                   \
+  void ASTWalker::visit(const type& node) {                           \
+    enter(node);                                                      \
+    for_each_child(node, [this](const auto* child) { walk(child); }); \
+  }                                                                   \
+  void MutableASTWalker::visit(type& node) {                          \
+    enter(node);                                                      \
+    for_each_child(node, [this](auto* child) { walk(child); });       \
+  }
+
+VISIT(Program)
+VISIT(PrintStmt)
+VISIT(IfStmt)
+VISIT(BlockStmt)
+VISIT(WhileStmt)
+VISIT(ForStmt)
+VISIT(ForRangeStmt)
+VISIT(VarDeclStmt)
+VISIT(StructFieldStmt)
+VISIT(StructDeclStmt)
+VISIT(VariantDeclStmt)
+VISIT(AssignStmt)
+VISIT(CallStmt)
+VISIT(FuncParamStmt)
+VISIT(FuncStmt)
+VISIT(ReturnStmt)
+VISIT(LambdaFuncStmt)
+VISIT(InspectStmt)
+
+VISIT(AdditionExpr)
+VISIT(SubtractionExpr)
+VISIT(DivisionExpr)
+VISIT(MultiplicationExpr)
+VISIT(EqualCompExpr)
+VISIT(NotEqualCompExpr)
+VISIT(GreaterCompExpr)
+VISIT(GreaterEqualCompExpr)
+VISIT(LessCompExpr)
+VISIT(LessEqualCompExpr)
+VISIT(GroupingExpr)
+VISIT(LiteralExpr)
+VISIT(NegationExpr)
+VISIT(LogicalNegationExpr)
+VISIT(VarExpr)
+VISIT(LogicalOrExpr)
+VISIT(LogicalAndExpr)
+VISIT(IsTypeExpr)
+VISIT(AsTypeExpr)
+VISIT(InitalizerListExpr)
+VISIT(CallExpr)
+VISIT(FieldAccessExpr)
+VISIT(IndexExpr)
+
+#undef VISIT
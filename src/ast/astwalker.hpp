@@ -0,0 +1,127 @@
+/*! @file astwalker.hpp
+    @brief Ast walker.
+*/
+
+#ifndef BOALANG_ASTWALKER_HPP
+#define BOALANG_ASTWALKER_HPP
+
+#include "expr/expr.hpp"
+#include "stmt/stmt.hpp"
+
+/**
+ * @brief Visits every node of abstract syntax tree in pre-order.
+ *
+ * Derived classes override visit() for nodes they are interested in (calling
+ * base implementation to keep descending) or enter() to handle all nodes.
+ */
+class ASTWalker : public ExprVisitor, public StmtVisitor {
+ protected:
+  virtual void enter(const Expr&) {} /**< Called for every expression. */
+  virtual void enter(const Stmt&) {} /**< Called for every statement. */
+
+  void walk(const Expr* expr); /**< Visits \p expr unless it is null. */
+  void walk(const Stmt* stmt); /**< Visits \p stmt unless it is null. */
+
+ public:
+  void visit(const Program& stmt) override;
+  void visit(const PrintStmt& stmt) override;
+  void visit(const IfStmt& stmt) override;
+  void visit(const BlockStmt& stmt) override;
+  void visit(const WhileStmt& stmt) override;
+  void visit(const ForStmt& stmt) override;
+  void visit(const ForRangeStmt& stmt) override;
+  void visit(const VarDeclStmt& stmt) override;
+  void visit(const StructFieldStmt& stmt) override;
+  void visit(const StructDeclStmt& stmt) override;
+  void visit(const VariantDeclStmt& stmt) override;
+  void visit(const AssignStmt& stmt) override;
+  void visit(const CallStmt& stmt) override;
+  void visit(const FuncParamStmt& stmt) override;
+  void visit(const FuncStmt& stmt) override;
+  void visit(const ReturnStmt& stmt) override;
+  void visit(const LambdaFuncStmt& stmt) override;
+  void visit(const InspectStmt& stmt) override;
+
+  void visit(const AdditionExpr& expr) override;
+  void visit(const SubtractionExpr& expr) override;
+  void visit(const DivisionExpr& expr) override;
+  void visit(const MultiplicationExpr& expr) override;
+  void visit(const EqualCompExpr& expr) override;
+  void visit(const NotEqualCompExpr& expr) override;
+  void visit(const GreaterCompExpr& expr) override;
+  void visit(const GreaterEqualCompExpr& expr) override;
+  void visit(const LessCompExpr& expr) override;
+  void visit(const LessEqualCompExpr& expr) override;
+  void visit(const GroupingExpr& expr) override;
+  void visit(const LiteralExpr& expr) override;
+  void visit(const NegationExpr& expr) override;
+  void visit(const LogicalNegationExpr& expr) override;
+  void visit(const VarExpr& expr) override;
+  void visit(const LogicalOrExpr& expr) override;
+  void visit(const LogicalAndExpr& expr) override;
+  void visit(const IsTypeExpr& expr) override;
+  void visit(const AsTypeExpr& expr) override;
+  void visit(const InitalizerListExpr& expr) override;
+  void visit(const CallExpr& expr) override;
+  void visit(const FieldAccessExpr& expr) override;
+  void visit(const IndexExpr& expr) override;
+};
+
+/**
+ * @brief Same as \ref ASTWalker, but allows derived classes to modify visited
+ * nodes.
+ */
+class MutableASTWalker : public MutableExprVisitor, public MutableStmtVisitor {
+ protected:
+  virtual void enter(Expr&) {} /**< Called for every expression. */
+  virtual void enter(Stmt&) {} /**< Called for every statement. */
+
+  void walk(Expr* expr); /**< Visits \p expr unless it is null. */
+  void walk(Stmt* stmt); /**< Visits \p stmt unless it is null. */
+
+ public:
+  void visit(Program& stmt) override;
+  void visit(PrintStmt& stmt) override;
+  void visit(IfStmt& stmt) override;
+  void visit(BlockStmt& stmt) override;
+  void visit(WhileStmt& stmt) override;
+  void visit(ForStmt& stmt) override;
+  void visit(ForRangeStmt& stmt) override;
+  void visit(VarDeclStmt& stmt) override;
+  void visit(StructFieldStmt& stmt) override;
+  void visit(StructDeclStmt& stmt) override;
+  void visit(VariantDeclStmt& stmt) override;
+  void visit(AssignStmt& stmt) override;
+  void visit(CallStmt& stmt) override;
+  void visit(FuncParamStmt& stmt) override;
+  void visit(FuncStmt& stmt) override;
+  void visit(ReturnStmt& stmt) override;
+  void visit(LambdaFuncStmt& stmt) override;
+  void visit(InspectStmt& stmt) override;
+
+  void visit(AdditionExpr& expr) override;
+  void visit(SubtractionExpr& expr) override;
+  void visit(DivisionExpr& expr) override;
+  void visit(MultiplicationExpr& expr) override;
+  void visit(EqualCompExpr& expr) override;
+  void visit(NotEqualCompExpr& expr) override;
+  void visit(GreaterCompExpr& expr) override;
+  void visit(GreaterEqualCompExpr& expr) override;
+  void visit(LessCompExpr& expr) override;
+  void visit(LessEqualCompExpr& expr) override;
+  void visit(GroupingExpr& expr) override;
+  void visit(LiteralExpr& expr) override;
+  void visit(NegationExpr& expr) override;
+  void visit(LogicalNegationExpr& expr) override;
+  void visit(VarExpr& expr) override;
+  void visit(LogicalOrExpr& expr) override;
+  void visit(LogicalAndExpr& expr) override;
+  void visit(IsTypeExpr& expr) override;
+  void visit(AsTypeExpr& expr) override;
+  void visit(InitalizerListExpr& expr) override;
+  void visit(CallExpr& expr) override;
+  void visit(FieldAccessExpr& expr) override;
+  void visit(IndexExpr& expr) override;
+};
+
+#endif  // BOALANG_ASTWALKER_HPP
@@ -0,0 +1,136 @@
+#include "engine.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "lexer/lexer.hpp"
+#include "optimizer/optimizer.hpp"
+#include "parser/parser.hpp"
+
+namespace boalang {
+
+namespace {
+
+thread_local Task* current_task = nullptr; /**< Task resumed on this thread. */
+
+/**
+ * @brief Makes \p task current for its lifetime.
+ */
+class CurrentTask {
+  Task* previous_;
+
+ public:
+  explicit CurrentTask(Task* task)
+      : previous_(std::exchange(current_task, task)){};
+  ~CurrentTask() { current_task = previous_; }
+
+  CurrentTask(const CurrentTask&) = delete;
+  CurrentTask& operator=(const CurrentTask&) = delete;
+};
+
+}  // namespace
+
+static bool is_value_type(BuiltinType type) {
+  return type == INT || type == FLOAT || type == STR || type == BOOL;
+}
+
+static Value to_value(const eval_value_t& value) {
+  return std::visit(
+      overloaded{
+          [](int arg) -> Value { return arg; },
+          [](float arg) -> Value { return arg; },
+          [](bool arg) -> Value { return arg; },
+          [](const StrValue& arg) -> Value { return std::string(arg.view()); },
+          [](const auto&) -> Value { return {}; },
+      },
+      value);
+}
+
+static eval_value_t from_value(const Value& value) {
+  return std::visit(
+      overloaded{
+          [](const std::string& arg) -> eval_value_t { return StrValue(arg); },
+          [](const auto& arg) -> eval_value_t { return arg; },
+      },
+      value);
+}
+
+Script Engine::compile(const std::string& code) {
+  StringSource source(code);
+  auto program = Parser(Lexer(source).tokenize()).parse();
+  optimize(*program);
+  return Script(std::move(program));
+}
+
+void Engine::register_function(const std::string& name, VarType return_type,
+                               const std::vector<VarType>& params,
+                               HostFunction function) {
+  if (return_type.type != VOID && !is_value_type(return_type.type)) {
+    throw std::invalid_argument("Unsupported return type of '" + name + "'");
+  }
+  std::vector<std::pair<std::string, VarType>> named_params;
+  for (const auto& param : params) {
+    if (!is_value_type(param.type)) {
+      throw std::invalid_argument("Unsupported parameter type of '" + name +
+                                  "'");
+    }
+    named_params.emplace_back("arg" + std::to_string(named_params.size()),
+                              param);
+  }
+
+  auto native =
+      [function = std::move(function)](const std::vector<eval_value_t>& args) {
+        std::vector<Value> values;
+        values.reserve(args.size());
+        for (const auto& arg : args) {
+          values.push_back(to_value(arg));
+        }
+        return from_value(function(values));
+      };
+  interpreter_.natives().define(std::make_shared<FunctionObject>(
+      name, std::move(return_type), std::move(named_params),
+      native_function_t(std::move(native))));
+}
+
+void Engine::run(const Script& script) {
+  interpreter_.reset();
+  interpreter_.visit(script.program());
+}
+
+std::unique_ptr<Task> Engine::start(const Script& script, std::ostream& out) {
+  auto task = std::make_unique<Task>(script, out);
+  task->interpreter().natives() = interpreter_.natives();
+  task->interpreter().limits() = interpreter_.limits();
+  task->interpreter().memory().set_limit(interpreter_.memory().limit());
+  return task;
+}
+
+Task::Task(Script script, std::ostream& out, std::size_t stack_size)
+    : script_(std::move(script)),
+      interpreter_(out),
+      fiber_([this] { interpreter_.visit(script_.program()); }, stack_size) {
+  interpreter_.set_yield_handler([this] { fiber_.suspend(); });
+}
+
+Task::~Task() {
+  // unwinding restores trackers made active by the suspended run, so it
+  // needs the same surroundings as resume()
+  ActiveTracker active(interpreter_.memory());
+  CurrentTask current(this);
+  fiber_.cancel();
+}
+
+Task::Status Task::resume() {
+  // values allocated after moving to another thread charge this task too
+  ActiveTracker active(interpreter_.memory());
+  CurrentTask current(this);
+  return fiber_.resume() ? Status::FINISHED : Status::SUSPENDED;
+}
+
+void Task::yield_current() {
+  if (current_task) {
+    current_task->interpreter_.yield();
+  }
+}
+
+}  // namespace boalang
@@ -0,0 +1,166 @@
+/*! @file engine.hpp
+    @brief Embedding API.
+*/
+
+#ifndef BOALANG_ENGINE_HPP
+#define BOALANG_ENGINE_HPP
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "engine/fiber.hpp"
+#include "interpreter/interpreter.hpp"
+#include "stmt/stmt.hpp"
+
+namespace boalang {
+
+/**
+ * @brief Value passed to and returned from host functions.
+ */
+using Value = std::variant<std::monostate, int, float, bool, std::string>;
+
+/**
+ * @brief Function implemented by host application, called with arguments of
+ * declared types.
+ */
+using HostFunction = std::function<Value(const std::vector<Value>&)>;
+
+/**
+ * @brief Compiled program, immutable and cheap to copy.
+ */
+class Script {
+  std::shared_ptr<const Program> program_;
+
+ public:
+  explicit Script(std::shared_ptr<const Program> program)
+      : program_(std::move(program)){};
+
+  [[nodiscard]] const Program& program() const { return *program_; }
+};
+
+/**
+ * @brief Run of a script that can be suspended and resumed later, also on
+ * another thread, without occupying a thread while suspended.
+ *
+ * Each task has its own interpreter and stack (see Fiber). It suspends
+ * after every ExecutionLimits::slice_steps steps and when a host function
+ * calls yield_current(), e.g. while waiting for I/O.
+ */
+class Task {
+  Script script_;
+  Interpreter interpreter_;
+  Fiber fiber_; /**< Destroyed first, unwinding frames of interpreter_. */
+
+ public:
+  enum class Status { SUSPENDED, FINISHED };
+
+  /**
+   * @brief Prepares \p script to be run by resume(), printing to \p out.
+   */
+  Task(Script script, std::ostream& out,
+       std::size_t stack_size = Fiber::DEFAULT_STACK_SIZE);
+  ~Task();
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  Task(Task&&) = delete;
+  Task& operator=(Task&&) = delete;
+
+  Interpreter& interpreter() { return interpreter_; }
+
+  /**
+   * @brief Runs script until it suspends or ends.
+   *
+   * @throws RuntimeError When execution fails, the task is finished then.
+   */
+  Status resume();
+
+  [[nodiscard]] bool finished() const { return fiber_.finished(); }
+
+  /**
+   * @brief Suspends task running on this thread, does nothing outside of
+   * tasks.
+   *
+   * Throws when the suspended task is destroyed, host functions must let the
+   * exception propagate (see Fiber::suspend()).
+   */
+  static void yield_current();
+};
+
+/**
+ * @brief Runs compiled scripts, each one starting with fresh global state.
+ *
+ * Host functions stay registered between runs.
+ */
+class Engine {
+  Interpreter interpreter_;
+
+ public:
+  /**
+   * @brief Constructs engine printing to \p out.
+   */
+  explicit Engine(std::ostream& out = std::cout) : interpreter_(out){};
+
+  /**
+   * @brief Lexes, parses and optimizes \p code (see optimize()).
+   *
+   * @throws LexerError, SyntaxError When \p code is invalid.
+   */
+  [[nodiscard]] static Script compile(const std::string& code);
+
+  /**
+   * @brief Makes typed C++ \p function callable from scripts as \p name.
+   *
+   * Types are derived from its signature (see NativeType), string
+   * parameters may be std::string_view viewing arguments without copying.
+   */
+  template <typename F>
+  void register_native(std::string name, F function) {
+    interpreter_.natives().define(std::move(name), std::move(function));
+  }
+
+  /**
+   * @brief Makes \p function callable from scripts as \p name, converting
+   * arguments and result to Value.
+   *
+   * @param return_type VOID or any builtin type of value.
+   * @param params Builtin types of values.
+   * @throws std::invalid_argument When types are not supported by Value.
+   */
+  void register_function(const std::string& name, VarType return_type,
+                         const std::vector<VarType>& params,
+                         HostFunction function);
+
+  /**
+   * @brief Memory held by scripts, its peak over all runs and the limit
+   * applied to each run.
+   */
+  MemoryTracker& memory() { return interpreter_.memory(); }
+
+  /**
+   * @brief Step limit and timeout applied to each run.
+   */
+  ExecutionLimits& limits() { return interpreter_.limits(); }
+
+  /**
+   * @brief Resets global state and executes \p script.
+   *
+   * @throws RuntimeError When execution fails.
+   */
+  void run(const Script& script);
+
+  /**
+   * @brief Creates suspendable run of \p script, printing to \p out, with
+   * host functions and limits of this engine.
+   */
+  [[nodiscard]] std::unique_ptr<Task> start(const Script& script,
+                                            std::ostream& out);
+};
+
+}  // namespace boalang
+
+#endif  // BOALANG_ENGINE_HPP
@@ -0,0 +1,100 @@
+#include "fiber.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <new>
+#include <utility>
+
+namespace boalang {
+
+namespace {
+
+/**
+ * @brief Thrown by suspend() of a cancelled fiber to unwind its stack.
+ */
+struct Cancelled {};
+
+thread_local Fiber* starting = nullptr; /**< Fiber entered for first time. */
+
+std::size_t page_size() {
+  return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+}  // namespace
+
+Fiber::Fiber(std::function<void()> body, std::size_t stack_size)
+    : stack_size_(stack_size), body_(std::move(body)) {
+  stack_ = mmap(nullptr, stack_size_ + page_size(), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (stack_ == MAP_FAILED) {  // NOLINT
+    throw std::bad_alloc();
+  }
+  // stack grows down, overflowing it faults on the guard page
+  mprotect(stack_, page_size(), PROT_NONE);
+
+  getcontext(&context_);
+  context_.uc_stack.ss_sp = static_cast<char*>(stack_) + page_size();
+  context_.uc_stack.ss_size = stack_size_;
+  context_.uc_link = &caller_;
+  makecontext(&context_, &Fiber::entry, 0);
+}
+
+Fiber::~Fiber() {
+  cancel();
+  munmap(stack_, stack_size_ + page_size());
+}
+
+void Fiber::cancel() {
+  cancelled_ = true;
+  // body that caught the unwinding exception and suspended again is resumed
+  // until it returns, as its stack is still in use
+  while (!finished_) {
+    switch_in();
+  }
+  // nobody waits for the result of a cancelled body
+  error_ = nullptr;
+}
+
+void Fiber::entry() {
+  // makecontext passes only int arguments, so the fiber comes from resume()
+  Fiber* fiber = std::exchange(starting, nullptr);
+  if (!fiber->cancelled_) {
+    try {
+      fiber->body_();
+    } catch (const Cancelled&) {
+    } catch (...) {
+      fiber->error_ = std::current_exception();
+    }
+  }
+  fiber->finished_ = true;
+  // returning switches to uc_link, the caller of the last resume()
+}
+
+void Fiber::switch_in() {
+  if (!started_) {
+    started_ = true;
+    starting = this;
+  }
+  swapcontext(&caller_, &context_);
+}
+
+bool Fiber::resume() {
+  if (finished_) {
+    return true;
+  }
+  switch_in();
+  if (error_) {
+    std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+  return finished_;
+}
+
+void Fiber::suspend() {
+  swapcontext(&context_, &caller_);
+  if (cancelled_) {
+    throw Cancelled{};
+  }
+}
+
+}  // namespace boalang
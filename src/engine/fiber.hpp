@@ -0,0 +1,85 @@
+/*! @file fiber.hpp
+    @brief Stackful coroutine.
+*/
+
+#ifndef BOALANG_FIBER_HPP
+#define BOALANG_FIBER_HPP
+
+#include <ucontext.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+
+namespace boalang {
+
+/**
+ * @brief Function running on its own stack, able to suspend from any depth
+ * of calls and to be resumed later, also on another thread.
+ *
+ * Stack is reserved with a guard page below it, pages are committed by the
+ * system only when touched. A fiber destroyed while suspended is resumed
+ * and unwound until its body returns, so that objects on its stack are
+ * destroyed.
+ */
+class Fiber {
+  ucontext_t context_{};
+  ucontext_t caller_{};
+  void* stack_;
+  std::size_t stack_size_;
+  std::function<void()> body_;
+  std::exception_ptr error_;
+  bool started_ = false;
+  bool finished_ = false;
+  bool cancelled_ = false;
+
+  static void entry();
+  void switch_in(); /**< Runs body until it suspends or returns. */
+
+ public:
+  static constexpr std::size_t DEFAULT_STACK_SIZE =
+      std::size_t{1} << 20; /**< Reserved, not committed, stack bytes. */
+
+  /**
+   * @brief Prepares \p body to be run by resume().
+   */
+  explicit Fiber(std::function<void()> body,
+                 std::size_t stack_size = DEFAULT_STACK_SIZE);
+  ~Fiber();
+
+  Fiber(const Fiber&) = delete;
+  Fiber& operator=(const Fiber&) = delete;
+  Fiber(Fiber&&) = delete;
+  Fiber& operator=(Fiber&&) = delete;
+
+  /**
+   * @brief Runs body until it suspends or returns.
+   *
+   * @return Whether body returned, also when it did before.
+   * @throws Exception thrown by body, which is finished then.
+   */
+  bool resume();
+
+  /**
+   * @brief Returns from resume() called for this fiber, continuing after
+   * the next one. Called only from within body.
+   *
+   * When the fiber is cancelled, throws an exception unwinding the body.
+   * Body must not swallow it, e.g. with catch (...) that does not rethrow,
+   * otherwise it keeps running until it returns.
+   */
+  void suspend();
+
+  /**
+   * @brief Unwinds suspended body, finishing the fiber. Called by destructor
+   * if it was not before. Exceptions thrown by body while unwinding are
+   * dropped.
+   */
+  void cancel();
+
+  [[nodiscard]] bool finished() const { return finished_; }
+};
+
+}  // namespace boalang
+
+#endif  // BOALANG_FIBER_HPP
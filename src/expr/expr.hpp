@@ -33,6 +33,7 @@ class AsTypeExpr;
 class InitalizerListExpr;
 class CallExpr;
 class FieldAccessExpr;
+class IndexExpr;
 
 /**
  * @brief Interface for expressions visitor.
@@ -70,6 +71,46 @@ class ExprVisitor {
   virtual void visit(const InitalizerListExpr& expr) = 0;
   virtual void visit(const CallExpr& expr) = 0;
   virtual void visit(const FieldAccessExpr& expr) = 0;
+  virtual void visit(const IndexExpr& expr) = 0;
+};
+
+/**
+ * @brief Interface for expressions visitor that may modify visited nodes.
+ */
+class MutableExprVisitor {
+ public:
+  virtual ~MutableExprVisitor() = default;
+
+  MutableExprVisitor() = default;
+  MutableExprVisitor(const MutableExprVisitor&) = delete;
+  MutableExprVisitor& operator=(const MutableExprVisitor&) = delete;
+
+  MutableExprVisitor(MutableExprVisitor&&) = default;
+  MutableExprVisitor& operator=(MutableExprVisitor&&) = default;
+
+  virtual void visit(AdditionExpr& expr) = 0;
+  virtual void visit(SubtractionExpr& expr) = 0;
+  virtual void visit(DivisionExpr& expr) = 0;
+  virtual void visit(MultiplicationExpr& expr) = 0;
+  virtual void visit(EqualCompExpr& expr) = 0;
+  virtual void visit(NotEqualCompExpr& expr) = 0;
+  virtual void visit(GreaterCompExpr& expr) = 0;
+  virtual void visit(GreaterEqualCompExpr& expr) = 0;
+  virtual void visit(LessCompExpr& expr) = 0;
+  virtual void visit(LessEqualCompExpr& expr) = 0;
+  virtual void visit(GroupingExpr& expr) = 0;
+  virtual void visit(LiteralExpr& expr) = 0;
+  virtual void visit(NegationExpr& expr) = 0;
+  virtual void visit(LogicalNegationExpr& expr) = 0;
+  virtual void visit(VarExpr& expr) = 0;
+  virtual void visit(LogicalOrExpr& expr) = 0;
+  virtual void visit(LogicalAndExpr& expr) = 0;
+  virtual void visit(IsTypeExpr& expr) = 0;
+  virtual void visit(AsTypeExpr& expr) = 0;
+  virtual void visit(InitalizerListExpr& expr) = 0;
+  virtual void visit(CallExpr& expr) = 0;
+  virtual void visit(FieldAccessExpr& expr) = 0;
+  virtual void visit(IndexExpr& expr) = 0;
 };
 
 /**
@@ -81,6 +122,7 @@ class Expr {
 
   virtual ~Expr() = default;
   virtual void accept(ExprVisitor& visitor) const = 0;
+  virtual void accept(MutableExprVisitor& visitor) = 0;
 
   Expr(Position position) : position(position){};
   Expr(const Expr&) = delete;
@@ -97,6 +139,9 @@ class ExprType : public Expr {
   void accept(ExprVisitor& visitor) const override {
     visitor.visit(static_cast<const Derived&>(*this));
   }
+  void accept(MutableExprVisitor& visitor) override {
+    visitor.visit(static_cast<Derived&>(*this));
+  }
 };
 
 template <typename Derived>
@@ -253,6 +298,8 @@ class AsTypeExpr : public CastExpr<AsTypeExpr> {
 class InitalizerListExpr : public ExprType<InitalizerListExpr> {
  public:
   std::vector<std::unique_ptr<Expr>> list;
+  bool local = false; /**< Value is consumed by the statement evaluating it
+                         and never escapes it. Set by optimizer. */
 
   explicit InitalizerListExpr(std::vector<std::unique_ptr<Expr>> list,
                               Position position)
@@ -263,6 +310,9 @@ class CallExpr : public ExprType<CallExpr> {
  public:
   std::string identifier;
   std::vector<std::unique_ptr<Expr>> arguments;
+  std::unique_ptr<Expr> inlined; /**< Body of called function with arguments
+                                    substituted, evaluated in place of the
+                                    call. Set by optimizer. */
 
   explicit CallExpr(std::string identifier, Position position,
                     std::vector<std::unique_ptr<Expr>> arguments = {})
@@ -283,4 +333,14 @@ class FieldAccessExpr : public ExprType<FieldAccessExpr> {
         field_name(std::move(field_name)){};
 };
 
+class IndexExpr : public ExprType<IndexExpr> {
+ public:
+  std::unique_ptr<Expr> array;
+  std::unique_ptr<Expr> index;
+
+  explicit IndexExpr(std::unique_ptr<Expr> array, std::unique_ptr<Expr> index,
+                     Position position)
+      : ExprType(position), array(std::move(array)), index(std::move(index)){};
+};
+
 #endif  // BOALANG_EXPR_HPP
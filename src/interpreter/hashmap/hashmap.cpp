@@ -0,0 +1,16 @@
+#include "hashmap.hpp"
+
+#include <functional>
+#include <string_view>
+
+#include "utils/overloaded.tpp"
+
+std::size_t hash_key(const map_key_t& key) {
+  return std::visit(overloaded{
+                        [](int value) { return std::hash<int>{}(value); },
+                        [](const StrValue& value) {
+                          return std::hash<std::string_view>{}(value.view());
+                        },
+                    },
+                    key);
+}
@@ -0,0 +1,198 @@
+/*! @file hashmap.hpp
+    @brief boalang map storage.
+*/
+
+#ifndef BOALANG_HASHMAP_HPP
+#define BOALANG_HASHMAP_HPP
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "interpreter/strvalue/strvalue.hpp"
+
+using map_key_t = std::variant<int, StrValue>; /**< Possible map keys. */
+
+/**
+ * @return Hash of \p key.
+ */
+std::size_t hash_key(const map_key_t& key);
+
+/**
+ * @brief Open-addressing hash table from map_key_t to \p V.
+ *
+ * Entries are kept in insertion order in a vector, slots hold their indices
+ * and are probed linearly. Erased entries leave holes in the vector, which
+ * are dropped when the table is rebuilt; slots are shifted back on erase, so
+ * probing never meets tombstones. Iteration follows insertion order.
+ */
+template <typename V>
+class HashMap {
+  static constexpr std::uint32_t EMPTY =
+      std::numeric_limits<std::uint32_t>::max(); /**< Unused slot. */
+  static constexpr unsigned MIN_BITS = 3;
+
+  struct Entry {
+    map_key_t key;
+    V value;
+    std::size_t hash;
+  };
+
+  std::vector<std::optional<Entry>> entries_;
+  std::vector<std::uint32_t> slots_ =
+      std::vector<std::uint32_t>(std::size_t{1} << MIN_BITS, EMPTY);
+  unsigned bits_ = MIN_BITS; /**< Log2 of number of slots. */
+  std::size_t size_ = 0;
+
+  /**
+   * @return Preferred slot of \p hash. Fibonacci hashing spreads keys
+   * differing only in high bits, e.g. multiples of a power of two.
+   */
+  [[nodiscard]] std::size_t home(std::size_t hash) const {
+    return static_cast<std::size_t>(
+        (static_cast<std::uint64_t>(hash) * 11400714819323198485ULL) >>
+        (64 - bits_));
+  }
+
+  /**
+   * @return Slot holding \p key, or empty slot where it belongs.
+   */
+  [[nodiscard]] std::size_t probe(const map_key_t& key,
+                                  std::size_t hash) const {
+    std::size_t mask = slots_.size() - 1;
+    for (std::size_t slot = home(hash);; slot = (slot + 1) & mask) {
+      std::uint32_t index = slots_[slot];
+      if (index == EMPTY) {
+        return slot;
+      }
+      const Entry& entry = *entries_[index];
+      if (entry.hash == hash && entry.key == key) {
+        return slot;
+      }
+    }
+  }
+
+  /**
+   * @brief Drops holes and resizes slots to keep load factor at most 1/2.
+   */
+  void rebuild() {
+    if (entries_.size() != size_) {
+      std::vector<std::optional<Entry>> entries;
+      entries.reserve(size_ + 1);
+      for (auto& entry : entries_) {
+        if (entry) {
+          entries.push_back(std::move(entry));
+        }
+      }
+      entries_ = std::move(entries);
+    }
+
+    bits_ = MIN_BITS;
+    while ((std::size_t{1} << bits_) < (size_ + 1) * 2) {
+      ++bits_;
+    }
+    slots_.assign(std::size_t{1} << bits_, EMPTY);
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+      slots_[probe(entries_[i]->key, entries_[i]->hash)] =
+          static_cast<std::uint32_t>(i);
+    }
+  }
+
+ public:
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  /**
+   * @return Bytes allocated for entries and slots.
+   */
+  [[nodiscard]] std::size_t memory_usage() const {
+    return entries_.capacity() * sizeof(std::optional<Entry>) +
+           slots_.capacity() * sizeof(std::uint32_t);
+  }
+
+  /**
+   * @return Pointer to value under \p key, nullptr if there is none.
+   */
+  [[nodiscard]] V* find(const map_key_t& key) {
+    std::uint32_t index = slots_[probe(key, hash_key(key))];
+    return index == EMPTY ? nullptr : &entries_[index]->value;
+  }
+
+  [[nodiscard]] bool contains(const map_key_t& key) const {
+    return slots_[probe(key, hash_key(key))] != EMPTY;
+  }
+
+  /**
+   * @brief Sets value under \p key, appending new keys at the end of
+   * iteration order.
+   */
+  void insert_or_assign(map_key_t key, V value) {
+    std::size_t hash = hash_key(key);
+    std::size_t slot = probe(key, hash);
+    if (slots_[slot] != EMPTY) {
+      entries_[slots_[slot]]->value = std::move(value);
+      return;
+    }
+    // holes count towards load, so that erase-heavy use rebuilds as well
+    if ((entries_.size() + 1) * 4 > slots_.size() * 3) {
+      rebuild();
+      slot = probe(key, hash);
+    }
+    slots_[slot] = static_cast<std::uint32_t>(entries_.size());
+    entries_.push_back(Entry{std::move(key), std::move(value), hash});
+    ++size_;
+  }
+
+  /**
+   * @return Whether \p key was present.
+   */
+  bool erase(const map_key_t& key) {
+    std::size_t slot = probe(key, hash_key(key));
+    if (slots_[slot] == EMPTY) {
+      return false;
+    }
+    entries_[slots_[slot]].reset();
+    --size_;
+    while (!entries_.empty() && !entries_.back()) {
+      entries_.pop_back();
+    }
+
+    // backward shift: move back entries whose probe sequence passes the slot
+    std::size_t mask = slots_.size() - 1;
+    for (std::size_t next = (slot + 1) & mask; slots_[next] != EMPTY;
+         next = (next + 1) & mask) {
+      std::size_t wanted = home(entries_[slots_[next]]->hash);
+      if (((next - wanted) & mask) >= ((next - slot) & mask)) {
+        slots_[slot] = slots_[next];
+        slot = next;
+      }
+    }
+    slots_[slot] = EMPTY;
+    return true;
+  }
+
+  /**
+   * @brief Calls \p func with every key and value in insertion order.
+   */
+  template <typename F>
+  void for_each(F&& func) {
+    for (auto& entry : entries_) {
+      if (entry) {
+        func(std::as_const(entry->key), entry->value);
+      }
+    }
+  }
+
+  template <typename F>
+  void for_each(F&& func) const {
+    for (const auto& entry : entries_) {
+      if (entry) {
+        func(entry->key, entry->value);
+      }
+    }
+  }
+};
+
+#endif  // BOALANG_HASHMAP_HPP
@@ -4,9 +4,48 @@
 #include <cassert>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <map>
 
+#include "ast/astwalker.hpp"
+#include "interpreter/native/stdlib.hpp"
 #include "utils/position.hpp"
 
+namespace {
+
+bool is_container(const VarType& type) {
+  return type.type == ARRAY || type.type == MAP;
+}
+
+/**
+ * @brief Finds returns of a function that return a call of the function
+ * itself, skipping nested functions which have their own returns.
+ */
+class TailCallFinder : public ASTWalker {
+  const std::string& identifier_;
+  std::vector<const ReturnStmt*> found_;
+
+ public:
+  explicit TailCallFinder(const std::string& identifier)
+      : identifier_(identifier) {}
+
+  std::vector<const ReturnStmt*> find(const BlockStmt& body) {
+    ASTWalker::visit(body);
+    return std::move(found_);
+  }
+
+  void visit(const FuncStmt&) override {}
+
+  void visit(const ReturnStmt& stmt) override {
+    if (const auto* call = dynamic_cast<const CallExpr*>(stmt.value.get());
+        call && call->identifier == identifier_) {
+      found_.push_back(&stmt);
+    }
+  }
+};
+
+}  // namespace
+
 template <typename VisitType>
 requires std::same_as<VisitType, Stmt> || std::same_as<VisitType, Expr>
     eval_value_t Interpreter::evaluate(const VisitType* visited) {
@@ -45,16 +84,89 @@ bool Interpreter::boolify(const eval_value_t& value) {
   return std::visit(overloaded{
                         [](int arg) { return arg != 0; },
                         [](float arg) { return arg != 0.F; },
-                        [](const std::string& arg) { return !arg.empty(); },
+                        [](const StrValue& arg) { return !arg.empty(); },
                         [](bool arg) { return arg; },
                         [](auto) { return true; },
                     },
                     value);
 }
 
+void Interpreter::reset() {
+  evaluation_.reset();
+  call_contexts_.clear();
+  scopes_.clear();
+  scopes_.push_back(std::make_unique<Scope>());
+  return_flag_ = false;
+  tail_call_.reset();
+  memoized_.clear();
+  for (const auto& list : local_lists_) {
+    list->values.clear();
+  }
+}
+
+void Interpreter::execute(const Stmt& stmt) {
+  try {
+    stmt.accept(*this);
+  } catch (const MemoryLimitError& e) {
+    throw RuntimeError(stmt.position, e.what());
+  }
+}
+
+void Interpreter::step(const Position& position) {
+  if (++steps_ > next_check_) {
+    check_limits(position);
+  }
+}
+
+void Interpreter::check_limits(const Position& position) {
+  if (limits_.max_steps && steps_ > *limits_.max_steps) {
+    throw RuntimeError(
+        position,
+        "Step limit of " + std::to_string(*limits_.max_steps) + " exceeded");
+  }
+  if (deadline_ && std::chrono::steady_clock::now() >= *deadline_) {
+    throw RuntimeError(position, "Time limit of " +
+                                     std::to_string(limits_.timeout->count()) +
+                                     " ms exceeded");
+  }
+  if (limits_.slice_steps && steps_ > next_yield_) {
+    next_yield_ += *limits_.slice_steps;
+    yield();
+  }
+
+  // the clock is read only every DEADLINE_CHECK_INTERVAL steps
+  next_check_ = deadline_ ? steps_ + DEADLINE_CHECK_INTERVAL
+                          : std::numeric_limits<std::uint64_t>::max();
+  if (limits_.max_steps) {
+    next_check_ = std::min(next_check_, *limits_.max_steps);
+  }
+  if (limits_.slice_steps) {
+    next_check_ = std::min(next_check_, next_yield_);
+  }
+}
+
+void Interpreter::yield() {
+  if (!yield_handler_) {
+    return;
+  }
+  auto start = std::chrono::steady_clock::now();
+  yield_handler_();
+  if (deadline_) {
+    *deadline_ += std::chrono::steady_clock::now() - start;
+  }
+}
+
 void Interpreter::visit(const Program& stmt) {
+  ActiveTracker active(memory_);
+  steps_ = 0;
+  next_yield_ = limits_.slice_steps.value_or(0);
+  deadline_.reset();
+  if (limits_.timeout) {
+    deadline_ = std::chrono::steady_clock::now() + *limits_.timeout;
+  }
+  check_limits(stmt.position);
   for (const auto& s : stmt.statements) {
-    s->accept(*this);
+    execute(*s);
   }
 }
 
@@ -64,14 +176,14 @@ void Interpreter::visit(const PrintStmt& stmt) {
   std::visit(
       overloaded{
           [&](auto) { throw RuntimeError(stmt.position, "Value unprintable"); },
-          [](int arg) { std::cout << std::to_string(arg); },
-          [](float arg) { std::cout << std::to_string(arg); },
-          [](const std::string& arg) { std::cout << arg; },
-          [](bool arg) { std::cout << std::string(arg ? "true" : "false"); },
+          [&](int arg) { *out_ << std::to_string(arg); },
+          [&](float arg) { *out_ << std::to_string(arg); },
+          [&](const StrValue& arg) { *out_ << arg.view(); },
+          [&](bool arg) { *out_ << std::string(arg ? "true" : "false"); },
       },
       value);
 
-  std::cout << '\n';
+  *out_ << '\n';
 }
 
 void Interpreter::visit(const LiteralExpr& expr) {
@@ -89,7 +201,7 @@ void Interpreter::visit(const IfStmt& stmt) {
 void Interpreter::visit(const BlockStmt& stmt) {
   create_new_scope();
   for (const auto& s : stmt.statements) {
-    s->accept(*this);
+    execute(*s);
     if (return_flag_) {
       break;
     }
@@ -99,18 +211,104 @@ void Interpreter::visit(const BlockStmt& stmt) {
 
 void Interpreter::visit(const WhileStmt& stmt) {
   while (boolify(evaluate(stmt.condition.get())) && !return_flag_) {
+    step(stmt.position);
     stmt.body->accept(*this);
   }
 }
 
+void Interpreter::visit(const ForStmt& stmt) {
+  auto iterable = evaluate_var(stmt.iterable.get());
+  auto run_body = [&](const eval_value_t& value) {
+    step(stmt.position);
+    create_new_scope();
+    bind_value(stmt.identifier, stmt.type, value, false, stmt.position);
+    stmt.body->accept(*this);
+    pop_last_scope();
+  };
+
+  if (const auto* map = std::get_if<std::shared_ptr<MapObject>>(&iterable)) {
+    if (!((*map)->key_type == stmt.type)) {
+      throw RuntimeError(stmt.position, "Loop variable '" + stmt.identifier +
+                                            "' has different type than map "
+                                            "keys");
+    }
+    // keys inserted by the body are not visited, removed ones are skipped
+    std::vector<map_key_t> keys;
+    keys.reserve((*map)->entries.size());
+    (*map)->entries.for_each(
+        [&keys](const map_key_t& key, const eval_value_t&) {
+          keys.push_back(key);
+        });
+    for (const auto& key : keys) {
+      if (return_flag_) {
+        break;
+      }
+      if ((*map)->entries.contains(key)) {
+        run_body(std::visit([](const auto& arg) -> eval_value_t { return arg; },
+                            key));
+      }
+    }
+    return;
+  }
+
+  const auto* array = std::get_if<std::shared_ptr<ArrayObject>>(&iterable);
+  if (!array) {
+    throw RuntimeError(stmt.position,
+                       "Cannot iterate over value that is not an array or map");
+  }
+  if (!((*array)->element_type == stmt.type)) {
+    throw RuntimeError(stmt.position, "Loop variable '" + stmt.identifier +
+                                          "' has different type than array "
+                                          "elements");
+  }
+
+  // elements appended by the body are not visited
+  const auto& elements = (*array)->elements;
+  std::size_t size = elements.size();
+  for (std::size_t i = 0; i < size && i < elements.size() && !return_flag_;
+       ++i) {
+    run_body(elements[i]);
+  }
+}
+
+void Interpreter::visit(const ForRangeStmt& stmt) {
+  auto begin = evaluate_var(stmt.begin.get());
+  auto end = evaluate_var(stmt.end.get());
+  const auto* first = std::get_if<int>(&begin);
+  const auto* last = std::get_if<int>(&end);
+  if (!first || !last) {
+    throw RuntimeError(stmt.position, "Range bounds must be ints");
+  }
+
+  // counter is kept here and only copied into a const variable visible to the
+  // body, so iterations skip comparison, assignment and type checks
+  create_new_scope();
+  auto var =
+      std::make_shared<Variable>(VarType(INT), stmt.identifier, false, *first);
+  define_variable(stmt.identifier, var);
+  for (int i = *first; i < *last && !return_flag_; ++i) {
+    step(stmt.position);
+    var->value = i;
+    stmt.body->accept(*this);
+  }
+  pop_last_scope();
+}
+
 void Interpreter::visit(const VarDeclStmt& stmt) {
-  if (const auto& var = get_variable(stmt.identifier)) {
+  if (get_variable(stmt.identifier)) {
     throw RuntimeError(stmt.position,
                        "Identifier '" + stmt.identifier + "' already defined");
   }
 
   auto init_value = clone_value(evaluate_var(stmt.initializer.get()));
 
+  if (is_container(stmt.type)) {
+    define_variable(stmt.identifier,
+                    make_container(stmt.type, init_value, stmt.mut,
+                                   stmt.identifier, stmt.position));
+    return;
+  }
+
   auto type = get_type(stmt.type.name);
   if (!type && !stmt.type.name.empty()) {
     throw RuntimeError(stmt.position,
@@ -120,7 +318,10 @@ void Interpreter::visit(const VarDeclStmt& stmt) {
   if (type) {
     std::visit(overloaded{
                    [&](const std::shared_ptr<StructType>& arg) {
-                     assign_init_list(&stmt, arg, init_value);
+                     define_variable(
+                         stmt.identifier,
+                         make_struct(arg, init_value, stmt.mut, stmt.identifier,
+                                     stmt.position));
                    },
                    [this, &stmt,
                     &init_value](const std::shared_ptr<VariantType>& arg) {
@@ -154,7 +355,7 @@ void Interpreter::visit(const VarDeclStmt& stmt) {
 void Interpreter::visit(const StructFieldStmt&) {}
 
 void Interpreter::visit(const StructDeclStmt& stmt) {
-  if (const auto& var = get_type(stmt.identifier)) {
+  if (get_type(stmt.identifier)) {
     throw RuntimeError(stmt.position,
                        "Type '" + stmt.identifier + "' already defined");
   }
@@ -170,7 +371,7 @@ void Interpreter::visit(const StructDeclStmt& stmt) {
 }
 
 void Interpreter::visit(const VariantDeclStmt& stmt) {
-  if (const auto& var = get_type(stmt.identifier)) {
+  if (get_type(stmt.identifier)) {
     throw RuntimeError(stmt.position,
                        "Type '" + stmt.identifier + "' already defined");
   }
@@ -188,6 +389,42 @@ void Interpreter::visit(const VariantDeclStmt& stmt) {
 }
 
 void Interpreter::visit(const AssignStmt& stmt) {
+  if (const auto* target = dynamic_cast<const IndexExpr*>(stmt.var.get())) {
+    auto value = clone_value(evaluate_var(stmt.value.get()));
+    auto container = evaluate_var(target->array.get());
+    auto index = evaluate_var(target->index.get());
+    auto check_mut = [&](bool mut, const std::string& name) {
+      if (!mut) {
+        throw RuntimeError(stmt.position,
+                           "Tried assigning value to a const '" + name + "'");
+      }
+    };
+    std::visit(
+        overloaded{
+            [&](const std::shared_ptr<ArrayObject>& array) {
+              check_mut(array->mut, array->name);
+              array->elements[element_index(*array, index, target->position)] =
+                  make_element(array->element_type, array->mut, array->name,
+                               value, stmt.position);
+            },
+            [&](const std::shared_ptr<MapObject>& map) {
+              check_mut(map->mut, map->name);
+              map->entries.insert_or_assign(
+                  map_key(*map, index, target->position),
+                  make_element(map->value_type, map->mut, map->name, value,
+                               stmt.position));
+              map->update_memory();
+            },
+            [&](const auto&) {
+              throw RuntimeError(
+                  target->position,
+                  "Cannot index a value that is not an array or map");
+            },
+        },
+        container);
+    return;
+  }
+
   auto var = evaluate(stmt.var.get());
   auto value = clone_value(evaluate_var(stmt.value.get()));
 
@@ -239,6 +476,43 @@ void Interpreter::visit(const AssignStmt& stmt) {
             }
             arg->scope = std::get<std::shared_ptr<StructObject>>(value)->scope;
           },
+          [&](const std::shared_ptr<ArrayObject>& arg) {
+            if (!arg->mut) {
+              throw RuntimeError(
+                  stmt.position,
+                  "Tried assigning value to a const '" + arg->name + "'");
+            }
+            auto type = VarType::array_of(arg->element_type);
+            if (!std::holds_alternative<std::shared_ptr<InitalizerList>>(
+                    value) &&
+                !match_type(value, type)) {
+              throw RuntimeError(
+                  stmt.position,
+                  "Tried assigning value with different type to '" + arg->name +
+                      "'");
+            }
+            arg->elements = std::move(
+                make_array(type, value, true, arg->name, stmt.position)
+                    ->elements);
+          },
+          [&](const std::shared_ptr<MapObject>& arg) {
+            if (!arg->mut) {
+              throw RuntimeError(
+                  stmt.position,
+                  "Tried assigning value to a const '" + arg->name + "'");
+            }
+            auto type = VarType::map_of(arg->key_type, arg->value_type);
+            if (!std::holds_alternative<std::shared_ptr<InitalizerList>>(
+                    value) &&
+                !match_type(value, type)) {
+              throw RuntimeError(
+                  stmt.position,
+                  "Tried assigning value with different type to '" + arg->name +
+                      "'");
+            }
+            arg->entries = std::move(
+                make_map(type, value, true, arg->name, stmt.position)->entries);
+          },
           [&](auto) {
             throw RuntimeError(stmt.position, "Invalid assignment");
           },
@@ -256,7 +530,8 @@ void Interpreter::visit(const CallStmt& stmt) {
 void Interpreter::visit(const FuncParamStmt&) {}
 
 void Interpreter::visit(const FuncStmt& stmt) {
-  if (const auto& var = get_function(stmt.identifier)) {
+  // native functions may be shadowed
+  if (const auto& var = get_function(stmt.identifier); var && !(*var)->native) {
     throw RuntimeError(stmt.position,
                        "Function '" + stmt.identifier + "' already defined");
   }
@@ -273,10 +548,18 @@ void Interpreter::visit(const FuncStmt& stmt) {
   }
   auto func = std::make_shared<FunctionObject>(stmt.identifier,
                                                stmt.return_type, params, body);
+  func->tail_calls = TailCallFinder(stmt.identifier).find(*body);
   define_function(stmt.identifier, func);
 }
 
 void Interpreter::visit(const ReturnStmt& stmt) {
+  if (is_tail_call(stmt)) {
+    const auto& call = static_cast<const CallExpr&>(*stmt.value);
+    tail_call_ = TailCall{get_call_args_values(call.arguments), call.position};
+    evaluation_.reset();
+    return_flag_ = true;
+    return;
+  }
   if (stmt.value) {
     set_evaluation(evaluate_var(stmt.value.get()));
   } else {
@@ -458,7 +741,7 @@ void Interpreter::visit(const AsTypeExpr& expr) {
                        set_evaluation(static_cast<float>(arg));
                        break;
                      case STR:
-                       set_evaluation(std::to_string(arg));
+                       set_evaluation(StrValue(std::to_string(arg)));
                        break;
                      case BOOL:
                        set_evaluation(boolify(arg));
@@ -477,7 +760,7 @@ void Interpreter::visit(const AsTypeExpr& expr) {
                        set_evaluation(arg);
                        break;
                      case STR:
-                       set_evaluation(std::to_string(arg));
+                       set_evaluation(StrValue(std::to_string(arg)));
                        break;
                      case BOOL:
                        set_evaluation(boolify(arg));
@@ -486,7 +769,7 @@ void Interpreter::visit(const AsTypeExpr& expr) {
                        throw RuntimeError(expr.position, "Invalid type cast");
                    }
                  },
-                 [&](std::string arg) {
+                 [&](const StrValue& arg) {
                    switch (type.type) {
                      case STR:
                        set_evaluation(arg);
@@ -501,7 +784,7 @@ void Interpreter::visit(const AsTypeExpr& expr) {
                  [&](bool arg) {
                    switch (type.type) {
                      case STR:
-                       set_evaluation(arg ? "true" : "false");
+                       set_evaluation(StrValue(arg ? "true" : "false"));
                        break;
                      case BOOL:
                        set_evaluation(arg);
@@ -527,14 +810,22 @@ void Interpreter::visit(const AsTypeExpr& expr) {
 }
 
 void Interpreter::visit(const InitalizerListExpr& expr) {
-  std::vector<eval_value_t> values{};
+  auto list =
+      expr.local
+          ? local_list()
+          : std::make_shared<InitalizerList>(std::vector<eval_value_t>{});
+  list->values.reserve(expr.list.size());
   for (const auto& e : expr.list) {
-    values.push_back(evaluate_var(e.get()));
+    list->values.push_back(evaluate_var(e.get()));
   }
-  set_evaluation(std::make_shared<InitalizerList>(std::move(values)));
+  set_evaluation(std::move(list));
 }
 
 void Interpreter::visit(const CallExpr& expr) {
+  if (expr.inlined) {
+    expr.inlined->accept(*this);
+    return;
+  }
   make_call(expr.identifier, expr.position, expr.arguments);
 }
 
@@ -554,37 +845,79 @@ void Interpreter::visit(const FieldAccessExpr& expr) {
                      "Cannot access field of a non-struct variable");
 }
 
+void Interpreter::visit(const IndexExpr& expr) {
+  auto container = evaluate_var(expr.array.get());
+  auto index = evaluate_var(expr.index.get());
+  std::visit(
+      overloaded{
+          [&](const std::shared_ptr<ArrayObject>& array) {
+            set_evaluation(
+                array->elements[element_index(*array, index, expr.position)]);
+          },
+          [&](const std::shared_ptr<MapObject>& map) {
+            auto* value =
+                map->entries.find(map_key(*map, index, expr.position));
+            if (!value) {
+              throw RuntimeError(expr.position,
+                                 "Key not found in '" + map->name + "'");
+            }
+            set_evaluation(*value);
+          },
+          [&](const auto&) {
+            throw RuntimeError(
+                expr.position,
+                "Cannot index a value that is not an array or map");
+          },
+      },
+      container);
+}
+
 Scope* Interpreter::create_new_scope() {
-  std::unique_ptr<Scope> new_scope;
-  if (!call_contexts_.empty()) {
-    new_scope =
-        std::make_unique<Scope>(call_contexts_.back()->scopes.back().get());
-    call_contexts_.back()->scopes.push_back(std::move(new_scope));
-    return call_contexts_.back()->scopes.back().get();
+  auto& scopes =
+      call_contexts_.empty() ? scopes_ : call_contexts_.back()->scopes;
+  Scope* enclosing = scopes.back().get();
+  if (free_scopes_.empty()) {
+    scopes.push_back(std::make_unique<Scope>(enclosing));
+  } else {
+    free_scopes_.back()->reset(enclosing);
+    scopes.push_back(std::move(free_scopes_.back()));
+    free_scopes_.pop_back();
   }
-  new_scope = std::make_unique<Scope>(scopes_.back().get());
-  scopes_.push_back(std::move(new_scope));
-  return scopes_.back().get();
+  return scopes.back().get();
 }
 
 void Interpreter::pop_last_scope() {
-  if (!call_contexts_.empty()) {
-    call_contexts_.back()->scopes.pop_back();
-  } else {
-    scopes_.pop_back();
+  auto& scopes =
+      call_contexts_.empty() ? scopes_ : call_contexts_.back()->scopes;
+  // values are released right away, only the emptied scope object is kept
+  scopes.back()->reset(nullptr);
+  free_scopes_.push_back(std::move(scopes.back()));
+  scopes.pop_back();
+}
+
+std::shared_ptr<InitalizerList> Interpreter::local_list() {
+  // lists being filled or consumed are referenced outside of local_lists_
+  for (auto list = local_lists_.rbegin(); list != local_lists_.rend(); ++list) {
+    if (list->use_count() == 1) {
+      (*list)->values.clear();
+      return *list;
+    }
   }
+  local_lists_.push_back(
+      std::make_shared<InitalizerList>(std::vector<eval_value_t>{}));
+  return local_lists_.back();
 }
 
-void Interpreter::assign_init_list(const VarDeclStmt* stmt,
-                                   const std::shared_ptr<StructType>& type,
-                                   const eval_value_t& init_value) {
+std::shared_ptr<StructObject> Interpreter::make_struct(
+    const std::shared_ptr<StructType>& type, const eval_value_t& init_value,
+    bool mut, const std::string& name, const Position& position) {
   if (const auto& init_list =
           std::get_if<std::shared_ptr<InitalizerList>>(&init_value)) {
     if (init_list->get()->values.size() != type->init_fields.size()) {
-      throw RuntimeError(stmt->position,
+      throw RuntimeError(position,
                          "Different number of struct fields and "
                          "values in initalizer list for '" +
-                             stmt->identifier + "'");
+                             name + "'");
     }
 
     Scope struct_scope{};
@@ -593,41 +926,23 @@ void Interpreter::assign_init_list(const VarDeclStmt* stmt,
          init_field != init_fields.rend(); ++init_field) {
       auto init_item = clone_value(init_list->get()->values.back());
       init_list->get()->values.pop_back();
+      if (is_container(init_field->type)) {
+        struct_scope.define_variable(
+            init_field->name,
+            make_container(init_field->type, init_item, init_field->mut,
+                           init_field->name, position));
+        continue;
+      }
       if (!match_type(init_item, init_field->type)) {
-        throw RuntimeError(stmt->position,
-                           "Type mismatch in initalizer list for '" +
-                               stmt->identifier + "." + init_field->name + "'");
+        throw RuntimeError(position, "Type mismatch in initalizer list for '" +
+                                         name + "." + init_field->name + "'");
       }
-      if (const auto& init_field_type = get_type(init_field->type.name)) {
-        std::visit(
-            overloaded{
-                [&](const std::shared_ptr<VariantType>& arg) {
-                  eval_value_t value = init_item;
-                  if (auto* variant_obj =
-                          std::get_if<std::shared_ptr<VariantObject>>(
-                              &init_item)) {
-                    value = (*variant_obj)->contained;
-                  }
-                  struct_scope.define_variable(
-                      init_field->name,
-                      std::make_shared<VariantObject>(
-                          arg.get(), init_field->mut, init_field->name, value));
-                },
-                [&](const std::shared_ptr<StructType>& arg) {
-                  auto struct_obj =
-                      std::get<std::shared_ptr<StructObject>>(init_item);
-                  struct_scope.define_variable(
-                      init_field->name,
-                      std::make_shared<StructObject>(arg.get(), init_field->mut,
-                                                     init_field->name,
-                                                     struct_obj->scope));
-                },
-                [&](const auto&) {
-                  throw RuntimeError(stmt->position,
-                                     "Unsupported type in struct declaration");
-                },
-            },
-            *init_field_type);
+      if (get_type(init_field->type.name)) {
+        // cloned struct and variant objects are taken over by the field
+        struct_scope.define_variable(
+            init_field->name,
+            make_element(init_field->type, init_field->mut, init_field->name,
+                         init_item, position));
       } else {
         struct_scope.define_variable(
             init_field->name,
@@ -635,24 +950,244 @@ void Interpreter::assign_init_list(const VarDeclStmt* stmt,
                                        init_field->mut, init_item));
       }
     }
-    auto obj = std::make_shared<StructObject>(
-        type.get(), stmt->mut, stmt->identifier, std::move(struct_scope));
-    define_variable(stmt->identifier, obj);
-  } else {
-    throw RuntimeError(stmt->position, "Expected initalizer list for '" +
-                                           stmt->identifier + "'");
+    return std::make_shared<StructObject>(type.get(), mut, name,
+                                          std::move(struct_scope));
   }
+  throw RuntimeError(position, "Expected initalizer list for '" + name + "'");
 }
 
-void Interpreter::call_func(FunctionObject* func) {
-  return_flag_ = false;
-  for (const auto& stmt : func->body->statements) {
-    stmt->accept(*this);
-    if (return_flag_) {
-      break;
+std::shared_ptr<ArrayObject> Interpreter::make_array(
+    const VarType& type, const eval_value_t& init_value, bool mut,
+    const std::string& name, const Position& position) {
+  if (const auto* init_list =
+          std::get_if<std::shared_ptr<InitalizerList>>(&init_value)) {
+    const auto& values = (*init_list)->values;
+    auto array = std::make_shared<ArrayObject>(*type.element, mut, name,
+                                               std::vector<eval_value_t>{});
+    array->elements.reserve(values.size());
+    for (const auto& value : values) {
+      array->elements.push_back(make_element(array->element_type, mut, name,
+                                             clone_value(value), position));
     }
+    // consumed like in make_struct(), so reused lists do not hold values
+    (*init_list)->values.clear();
+    array->update_memory();
+    return array;
   }
-  return_flag_ = false;
+  if (const auto* array =
+          std::get_if<std::shared_ptr<ArrayObject>>(&init_value);
+      array && match_type(init_value, type)) {
+    (*array)->set_mut(mut);
+    (*array)->name = name;
+    return *array;
+  }
+  throw RuntimeError(position,
+                     "Expected array or initalizer list for '" + name + "'");
+}
+
+std::shared_ptr<MapObject> Interpreter::make_map(const VarType& type,
+                                                 const eval_value_t& init_value,
+                                                 bool mut,
+                                                 const std::string& name,
+                                                 const Position& position) {
+  if (const auto* init_list =
+          std::get_if<std::shared_ptr<InitalizerList>>(&init_value)) {
+    auto map = std::make_shared<MapObject>(*type.key, *type.element, mut, name);
+    for (const auto& item : (*init_list)->values) {
+      const auto* pair = std::get_if<std::shared_ptr<InitalizerList>>(&item);
+      if (!pair || (*pair)->values.size() != 2) {
+        throw RuntimeError(position,
+                           "Expected {key, value} pairs in initalizer list "
+                           "for '" +
+                               name + "'");
+      }
+      map->entries.insert_or_assign(
+          map_key(*map, (*pair)->values[0], position),
+          make_element(map->value_type, mut, name,
+                       clone_value((*pair)->values[1]), position));
+      (*pair)->values.clear();
+    }
+    (*init_list)->values.clear();
+    map->update_memory();
+    return map;
+  }
+  if (const auto* map = std::get_if<std::shared_ptr<MapObject>>(&init_value);
+      map && match_type(init_value, type)) {
+    (*map)->set_mut(mut);
+    (*map)->name = name;
+    return *map;
+  }
+  throw RuntimeError(position,
+                     "Expected map or initalizer list for '" + name + "'");
+}
+
+eval_value_t Interpreter::make_container(const VarType& type,
+                                         const eval_value_t& init_value,
+                                         bool mut, const std::string& name,
+                                         const Position& position) {
+  if (type.type == MAP) {
+    return make_map(type, init_value, mut, name, position);
+  }
+  return make_array(type, init_value, mut, name, position);
+}
+
+eval_value_t Interpreter::make_element(const VarType& type, bool mut,
+                                       const std::string& name,
+                                       const eval_value_t& value,
+                                       const Position& position) {
+  if (is_container(type)) {
+    return make_container(type, value, mut, name, position);
+  }
+  auto mismatch = [&] {
+    return RuntimeError(position, "Type mismatch in element of '" + name + "'");
+  };
+  if (const auto* element_type = get_type(type.name)) {
+    return std::visit(
+        overloaded{
+            [&](const std::shared_ptr<StructType>& arg) -> eval_value_t {
+              if (std::holds_alternative<std::shared_ptr<InitalizerList>>(
+                      value)) {
+                return make_struct(arg, value, mut, name, position);
+              }
+              const auto* struct_obj =
+                  std::get_if<std::shared_ptr<StructObject>>(&value);
+              if (!struct_obj || !match_type(value, type)) {
+                throw mismatch();
+              }
+              (*struct_obj)->mut = mut;
+              (*struct_obj)->name = name;
+              return *struct_obj;
+            },
+            [&](const std::shared_ptr<VariantType>& arg) -> eval_value_t {
+              if (!match_type(value, type)) {
+                throw mismatch();
+              }
+              eval_value_t contained = value;
+              if (const auto* variant_obj =
+                      std::get_if<std::shared_ptr<VariantObject>>(&value)) {
+                if ((*variant_obj)->type_def == arg.get()) {
+                  (*variant_obj)->mut = mut;
+                  (*variant_obj)->name = name;
+                  return *variant_obj;
+                }
+                contained = (*variant_obj)->contained;
+              }
+              return std::make_shared<VariantObject>(arg.get(), mut, name,
+                                                     contained);
+            },
+        },
+        *element_type);
+  }
+  if (!match_type(value, type)) {
+    throw mismatch();
+  }
+  return value;
+}
+
+std::size_t Interpreter::element_index(const ArrayObject& array,
+                                       const eval_value_t& index,
+                                       const Position& position) {
+  const auto* index_value = std::get_if<int>(&index);
+  if (!index_value) {
+    throw RuntimeError(position, "Array index must be an int");
+  }
+  std::size_t size = array.elements.size();
+  if (*index_value < 0 || static_cast<std::size_t>(*index_value) >= size) {
+    throw RuntimeError(position, "Index " + std::to_string(*index_value) +
+                                     " out of bounds for '" + array.name +
+                                     "' of size " + std::to_string(size));
+  }
+  return static_cast<std::size_t>(*index_value);
+}
+
+map_key_t Interpreter::map_key(const MapObject& map, const eval_value_t& key,
+                               const Position& position) {
+  if (map.key_type.type == INT) {
+    if (const auto* value = std::get_if<int>(&key)) {
+      return *value;
+    }
+  } else if (const auto* value = std::get_if<StrValue>(&key)) {
+    return *value;
+  }
+  throw RuntimeError(position, "Type mismatch in key of '" + map.name + "'");
+}
+
+Position Interpreter::call_func(FunctionObject* func, Position position) {
+  while (true) {
+    return_flag_ = false;
+    try {
+      for (const auto& stmt : func->body->statements) {
+        execute(*stmt);
+        if (return_flag_) {
+          break;
+        }
+      }
+    } catch (...) {
+      // a while condition is evaluated after a tail call is made, a call
+      // pending when it fails must not be run by the next function returning
+      tail_call_.reset();
+      throw;
+    }
+    return_flag_ = false;
+    if (!tail_call_) {
+      return position;
+    }
+
+    // blocks of the body popped their scopes while returning, only the one
+    // holding parameters is left to be rebound
+    auto call = std::move(*tail_call_);
+    tail_call_.reset();
+    position = call.position;
+    step(position);
+    call_contexts_.back()->scopes.front()->reset(nullptr);
+    bind_args_to_params(func, call.args, position);
+  }
+}
+
+bool Interpreter::is_tail_call(const ReturnStmt& stmt) const {
+  if (call_contexts_.empty()) {
+    return false;
+  }
+  const auto& func = call_contexts_.back()->function;
+  if (std::ranges::find(func->tail_calls, &stmt) == func->tail_calls.end()) {
+    return false;
+  }
+  // name may be shadowed by function defined in the body, and arguments are
+  // checked by the regular call
+  const auto& call = static_cast<const CallExpr&>(*stmt.value);
+  const auto* found = get_function(call.identifier);
+  return found && *found == func &&
+         call.arguments.size() == func->params.size();
+}
+
+void Interpreter::call_native_func(const FunctionObject* func,
+                                   const std::vector<eval_value_t>& args,
+                                   const Position& position) {
+  for (std::size_t i = 0; i < args.size(); ++i) {
+    if (!match_type(args[i], func->params[i].second)) {
+      throw RuntimeError(position, "Type mismatch in call arguments for '" +
+                                       func->identifier + "'");
+    }
+  }
+
+  eval_value_t result;
+  try {
+    result = func->native(args);
+  } catch (const NativeError& e) {
+    throw RuntimeError(position, e.what());
+  }
+  if (func->return_type.type == VOID) {
+    if (!std::holds_alternative<std::monostate>(result)) {
+      throw RuntimeError(position, "Void function returned a value");
+    }
+    evaluation_.reset();
+    return;
+  }
+  if (!match_type(result, func->return_type)) {
+    throw RuntimeError(
+        position, "Function returned value with different type than declared");
+  }
+  set_evaluation(std::move(result));
 }
 
 std::vector<eval_value_t> Interpreter::get_call_args_values(
@@ -683,48 +1218,66 @@ void Interpreter::bind_args_to_params(const FunctionObject* func,
                                       const Position& position) {
   for (size_t i = 0; i < args.size(); ++i) {
     const auto& param = func->params.at(i);
-    if (!match_type(args.at(i), param.second)) {
+    bool container_list =
+        is_container(param.second) &&
+        std::holds_alternative<std::shared_ptr<InitalizerList>>(args.at(i));
+    if (!container_list && !match_type(args.at(i), param.second)) {
       throw RuntimeError(position, "Type mismatch in call arguments for '" +
                                        func->identifier + "'");
     }
+    bind_value(param.first, param.second, args.at(i), true, position);
+  }
+}
 
-    if (auto type = get_type(param.second.name)) {
-      std::visit(
-          overloaded{
-              [&](const std::shared_ptr<StructType>&) {
-                auto struct_obj = std::get<std::shared_ptr<StructObject>>(
-                    clone_value(args.at(i)));
-                struct_obj->mut = true;
-                struct_obj->name = param.first;
-                define_variable(param.first, struct_obj);
-              },
-              [&](const std::shared_ptr<VariantType>&) {
-                auto variant_obj = std::get<std::shared_ptr<VariantObject>>(
-                    clone_value(args.at(i)));
-                variant_obj->mut = true;
-                variant_obj->name = param.first;
-                define_variable(param.first, variant_obj);
-              },
-              [&](auto) { throw RuntimeError(position, "Unknown type"); },
-          },
-          *type);
-    } else {
-      auto var = std::make_shared<Variable>(param.second.type, param.first,
-                                            true, clone_value(args.at(i)));
-      define_variable(param.first, var);
-    }
+void Interpreter::bind_value(const std::string& name, const VarType& type,
+                             const eval_value_t& value, bool mut,
+                             const Position& position) {
+  if (is_container(type)) {
+    define_variable(
+        name, make_container(type, clone_value(value), mut, name, position));
+    return;
+  }
+
+  if (auto found = get_type(type.name)) {
+    std::visit(
+        overloaded{
+            [&](const std::shared_ptr<StructType>&) {
+              auto struct_obj =
+                  std::get<std::shared_ptr<StructObject>>(clone_value(value));
+              struct_obj->mut = mut;
+              struct_obj->name = name;
+              define_variable(name, struct_obj);
+            },
+            [&](const std::shared_ptr<VariantType>&) {
+              auto variant_obj =
+                  std::get<std::shared_ptr<VariantObject>>(clone_value(value));
+              variant_obj->mut = mut;
+              variant_obj->name = name;
+              define_variable(name, variant_obj);
+            },
+            [&](auto) { throw RuntimeError(position, "Unknown type"); },
+        },
+        *found);
+  } else {
+    auto var =
+        std::make_shared<Variable>(type.type, name, mut, clone_value(value));
+    define_variable(name, var);
   }
 }
 
 void Interpreter::make_call(
     const std::string& identifier, const Position& position,
     const std::vector<std::unique_ptr<Expr>>& arguments) {
-  auto opt_func = get_function(identifier);
-  if (!opt_func) {
+  const auto* found = get_function(identifier);
+  if (!found) {
+    if (call_container_builtin(identifier, position, arguments)) {
+      return;
+    }
     throw RuntimeError(position, "Function '" + identifier + "' not defined");
   }
 
-  auto func = *opt_func;
+  // arguments cannot define functions, so the found one stays valid
+  const function_t& func = *found;
 
   auto args = get_call_args_values(arguments);
   if (args.size() != func->params.size()) {
@@ -732,28 +1285,161 @@ void Interpreter::make_call(
         position, "Invalid number of arguments in '" + identifier + "' call");
   }
 
+  step(position);
+  if (func->native) {
+    call_native_func(func.get(), args, position);
+    return;
+  }
+
+  Memo* memo = memo_of(func);
+  std::optional<Memo::key_t> key;
+  if (memo) {
+    key = Memo::key(args);
+    if (const auto* result = memo->find(*key)) {
+      set_evaluation(*result);
+      return;
+    }
+  }
+
   create_call_context(func, position);
   bind_args_to_params(func.get(), args, position);
-  call_func(func.get());
+  // result is checked where the last of the self calls was made
+  Position returned_from = call_func(func.get(), position);
 
   if (func->return_type.type == VOID) {
     if (evaluation_) {
-      throw RuntimeError(position, "Void function returned a value");
+      throw RuntimeError(returned_from, "Void function returned a value");
     }
   } else {
     if (!evaluation_) {
-      throw RuntimeError(position, "Non-void function did not return a value");
+      throw RuntimeError(returned_from,
+                         "Non-void function did not return a value");
+    }
+    if (is_container(func->return_type) &&
+        std::holds_alternative<std::shared_ptr<InitalizerList>>(*evaluation_)) {
+      set_evaluation(make_container(func->return_type, *evaluation_, false,
+                                    func->identifier, returned_from));
     }
     if (!match_type(*evaluation_, func->return_type)) {
       throw RuntimeError(
-          position,
+          returned_from,
           "Function returned value with different type than declared");
     }
   }
+  if (memo) {
+    memo->insert(std::move(*key), *evaluation_);
+  }
 
   pop_call_context();
 }
 
+Memo* Interpreter::memo_of(const function_t& func) {
+  if (!memo_capacity_) {
+    return nullptr;
+  }
+  if (!func->memo_checked) {
+    func->memo_checked = true;
+    std::vector<const FunctionObject*> visiting;
+    if (is_memoizable(*func) && is_pure(*func, visiting)) {
+      func->memo = std::make_shared<Memo>(*memo_capacity_);
+      memoized_.push_back(func);
+    }
+  }
+  return func->memo.get();
+}
+
+bool Interpreter::is_pure(const FunctionObject& func,
+                          std::vector<const FunctionObject*>& visiting) const {
+  // host functions may do anything
+  if (func.native) {
+    return false;
+  }
+  auto callees = pure_body_callees(func);
+  if (!callees) {
+    return false;
+  }
+  // only functions of the outermost scope cannot be shadowed or dropped while
+  // results are cached
+  visiting.push_back(&func);
+  bool pure = std::ranges::all_of(*callees, [&](const std::string& name) {
+    const auto* callee = scopes_.front()->get_function(name);
+    return callee &&
+           (std::ranges::find(visiting, callee->get()) != visiting.end() ||
+            is_pure(**callee, visiting));
+  });
+  visiting.pop_back();
+  return pure;
+}
+
+std::vector<std::pair<std::string, MemoStats>> Interpreter::memo_stats() const {
+  std::vector<std::pair<std::string, MemoStats>> stats;
+  stats.reserve(memoized_.size());
+  for (const auto& func : memoized_) {
+    stats.emplace_back(func->identifier, func->memo->stats());
+  }
+  return stats;
+}
+
+bool Interpreter::call_container_builtin(
+    const std::string& identifier, const Position& position,
+    const std::vector<std::unique_ptr<Expr>>& arguments) {
+  static const std::map<std::string, std::size_t> arities = {
+      {"size", 1}, {"push", 2}, {"contains", 2}, {"remove", 2}};
+  auto arity = arities.find(identifier);
+  if (arity == arities.end()) {
+    return false;
+  }
+
+  auto args = get_call_args_values(arguments);
+  if (args.size() != arity->second) {
+    throw RuntimeError(
+        position, "Invalid number of arguments in '" + identifier + "' call");
+  }
+  auto mismatch = [&] {
+    return RuntimeError(
+        position, "Type mismatch in call arguments for '" + identifier + "'");
+  };
+  auto check_mut = [&](bool mut, const std::string& name) {
+    if (!mut) {
+      throw RuntimeError(position, "Tried modifying a const '" + name + "'");
+    }
+  };
+
+  std::visit(overloaded{
+                 [&](const std::shared_ptr<ArrayObject>& array) {
+                   if (identifier == "size") {
+                     set_evaluation(static_cast<int>(array->elements.size()));
+                   } else if (identifier == "push") {
+                     check_mut(array->mut, array->name);
+                     array->elements.push_back(make_element(
+                         array->element_type, array->mut, array->name,
+                         clone_value(args[1]), position));
+                     array->update_memory();
+                     evaluation_.reset();
+                   } else {
+                     throw mismatch();
+                   }
+                 },
+                 [&](const std::shared_ptr<MapObject>& map) {
+                   if (identifier == "size") {
+                     set_evaluation(static_cast<int>(map->entries.size()));
+                   } else if (identifier == "contains") {
+                     set_evaluation(map->entries.contains(
+                         map_key(*map, args[1], position)));
+                   } else if (identifier == "remove") {
+                     check_mut(map->mut, map->name);
+                     set_evaluation(
+                         map->entries.erase(map_key(*map, args[1], position)));
+                   } else {
+                     throw mismatch();
+                   }
+                 },
+                 [&](const auto&) { throw mismatch(); },
+             },
+             args[0]);
+  return true;
+}
+
 void Interpreter::define_variable(const std::string& name,
                                   const eval_value_t& variable) {
   if (!call_contexts_.empty()) {
@@ -780,10 +1466,9 @@ void Interpreter::define_function(const std::string& name,
   }
 }
 
-std::optional<eval_value_t> Interpreter::get_variable(
-    const std::string& name) const {
+const eval_value_t* Interpreter::get_variable(const std::string& name) const {
   if (!call_contexts_.empty()) {
-    if (auto variable =
+    if (const auto* variable =
             call_contexts_.back()->scopes.back()->get_variable(name)) {
       return variable;
     }
@@ -791,23 +1476,31 @@ std::optional<eval_value_t> Interpreter::get_variable(
   return scopes_.back()->get_variable(name);
 }
 
-std::optional<types_t> Interpreter::get_type(const std::string& name) const {
+const types_t* Interpreter::get_type(const std::string& name) const {
   if (!call_contexts_.empty()) {
-    if (auto type = call_contexts_.back()->scopes.back()->get_type(name)) {
+    if (const auto* type =
+            call_contexts_.back()->scopes.back()->get_type(name)) {
       return type;
     }
   }
   return scopes_.back()->get_type(name);
 }
 
-std::optional<function_t> Interpreter::get_function(
-    const std::string& name) const {
+const function_t* Interpreter::get_function(const std::string& name) const {
   if (!call_contexts_.empty()) {
-    if (auto func = call_contexts_.back()->scopes.back()->get_function(name)) {
+    if (const auto* func =
+            call_contexts_.back()->scopes.back()->get_function(name)) {
       return func;
     }
   }
-  return scopes_.back()->get_function(name);
+  if (const auto* func = scopes_.back()->get_function(name)) {
+    return func;
+  }
+  // standard library is consulted last, so it never delays user functions
+  if (const auto* func = natives_.find(name)) {
+    return func;
+  }
+  return standard_library().find(name);
 }
 
 bool Interpreter::match_type(const eval_value_t& actual,
@@ -821,38 +1514,58 @@ bool Interpreter::match_type(const eval_value_t& actual,
   return scopes_.back()->match_type(actual, expected, check_self);
 }
 
-template <typename T, typename Operation>
-requires std::integral<T> || std::floating_point<T>
-bool Interpreter::is_overflow(const T& left, const T& right, Operation) {
+template <typename Operation>
+int Interpreter::int_arithmetic(int lhs, int rhs, Operation,
+                                const Position& position) {
+  int result = 0;
   if constexpr (std::is_same_v<Operation, std::plus<>>) {
-    if ((right > 0 && left > std::numeric_limits<T>::max() - right) ||
-        (right < 0 && left < std::numeric_limits<T>::min() - right)) {
-      return true;
+    if (__builtin_add_overflow(lhs, rhs, &result)) {
+      throw RuntimeError(position, "Detected overflow");
+    }
+  } else if constexpr (std::is_same_v<Operation, std::minus<>>) {
+    if (__builtin_sub_overflow(lhs, rhs, &result)) {
+      throw RuntimeError(position, "Detected underflow");
     }
   } else if constexpr (std::is_same_v<Operation, std::multiplies<>>) {
-    if ((right > 0 && left > std::numeric_limits<T>::max() / right) ||
-        (right < 0 && left < std::numeric_limits<T>::min() / right)) {
-      return true;
+    if (__builtin_mul_overflow(lhs, rhs, &result)) {
+      // product of operands with equal signs can only exceed the upper bound
+      throw RuntimeError(position, (lhs < 0) == (rhs < 0)
+                                       ? "Detected overflow"
+                                       : "Detected underflow");
     }
+  } else {
+    if (rhs == 0) {
+      throw RuntimeError(position, "Division by zero");
+    }
+    if (lhs == std::numeric_limits<int>::min() && rhs == -1) {
+      throw RuntimeError(position, "Detected overflow");
+    }
+    result = lhs / rhs;
   }
-  return false;
+  return result;
 }
 
-template <typename T, typename Operation>
-requires std::integral<T> || std::floating_point<T>
-bool Interpreter::is_underflow(const T& left, const T& right, Operation) {
-  if constexpr (std::is_same_v<Operation, std::minus<>>) {
-    if ((right > 0 && left < std::numeric_limits<T>::min() + right) ||
-        (right < 0 && left > std::numeric_limits<T>::max() + right)) {
-      return true;
+template <typename Operation>
+float Interpreter::float_arithmetic(float lhs, float rhs, Operation op,
+                                    const Position& position) {
+  if constexpr (std::is_same_v<Operation, std::divides<>>) {
+    if (rhs == 0) {
+      throw RuntimeError(position, "Division by zero");
     }
-  } else if constexpr (std::is_same_v<Operation, std::multiplies<>>) {
-    if ((right > 0 && left < std::numeric_limits<T>::min() / right) ||
-        (right < 0 && left > std::numeric_limits<T>::max() / right)) {
-      return true;
+    return op(lhs, rhs);
+  } else {
+    float result = op(lhs, rhs);
+    if (std::isinf(result) && !std::isinf(lhs) && !std::isinf(rhs)) {
+      if constexpr (std::is_same_v<Operation, std::minus<>>) {
+        throw RuntimeError(position, "Detected underflow");
+      } else if constexpr (std::is_same_v<Operation, std::multiplies<>>) {
+        throw RuntimeError(
+            position, result > 0 ? "Detected overflow" : "Detected underflow");
+      }
+      throw RuntimeError(position, "Detected overflow");
     }
+    return result;
   }
-  return false;
 }
 
 template <typename Operation>
@@ -862,41 +1575,48 @@ void Interpreter::perform_arithmetic_operation(Expr* left, Expr* right,
   auto leftValue = evaluate_var(left);
   auto rightValue = evaluate_var(right);
 
+  // fast paths for the most common operand types, selected by the variant's
+  // type tag instead of a visit over both operands
+  if (leftValue.index() == rightValue.index()) {
+    if (const auto* lhs = std::get_if<int>(&leftValue)) {
+      set_evaluation(
+          int_arithmetic(*lhs, std::get<int>(rightValue), op, position));
+      return;
+    }
+    if (const auto* lhs = std::get_if<float>(&leftValue)) {
+      set_evaluation(
+          float_arithmetic(*lhs, std::get<float>(rightValue), op, position));
+      return;
+    }
+  }
+
   std::visit(
       overloaded{
-     [&]<typename T>(T lhs, T rhs)
-     requires std::integral<T> || std::floating_point<T>
-     {
-      if constexpr (std::is_same_v<Operation, std::divides<>>) {
-        if (rhs == 0) {
-          throw RuntimeError(position, "Division by zero");
-        }
-      }
-      if (is_overflow(lhs, rhs, op)) {
-        throw RuntimeError(position, "Detected overflow");
-      }
-      if (is_underflow(lhs, rhs, op)) {
-        throw RuntimeError(position, "Detected underflow");
-      }
-      set_evaluation(op(lhs, rhs));
-    },
-    [&](const std::string& lhs, const std::string& rhs) {
-      if constexpr (std::is_same_v<Operation, std::plus<>>) {
-        set_evaluation(lhs + rhs);
-      } else {
-        throw RuntimeError(position, "Unsupported operation for strings");
-      }
-    },
-    [&]<typename T>(T, T) {
-      throw RuntimeError(position,
-                         "Unsupported types for arithmetic operation");
-    },
-    [&](auto, auto) {
-      throw RuntimeError(
-          position,
-          "Arithmetic operation cannot be applied to different types");
-    },
-},
+          [&](bool lhs, bool rhs) {
+            if constexpr (std::is_same_v<Operation, std::divides<>>) {
+              if (!rhs) {
+                throw RuntimeError(position, "Division by zero");
+              }
+            }
+            set_evaluation(op(lhs, rhs));
+          },
+          [&](const StrValue& lhs, const StrValue& rhs) {
+            if constexpr (std::is_same_v<Operation, std::plus<>>) {
+              set_evaluation(lhs + rhs);
+            } else {
+              throw RuntimeError(position, "Unsupported operation for strings");
+            }
+          },
+          [&]<typename T>(T, T) {
+            throw RuntimeError(position,
+                               "Unsupported types for arithmetic operation");
+          },
+          [&](auto, auto) {
+            throw RuntimeError(
+                position,
+                "Arithmetic operation cannot be applied to different types");
+          },
+      },
       leftValue, rightValue);
 }
 
@@ -910,7 +1630,7 @@ void Interpreter::perform_comparison_operation(Expr* left, Expr* right,
   std::visit(
       overloaded{
           [&]<typename T>(T lhs, T rhs)
-          requires std::integral<T> || std::floating_point<T> || std::same_as<bool, T> || std::same_as<std::string, T>
+          requires std::integral<T> || std::floating_point<T> || std::same_as<bool, T> || std::same_as<StrValue, T>
           {
             set_evaluation(op(lhs, rhs));
           },
@@ -5,25 +5,80 @@
 #ifndef BOALANG_INTERPRETER_HPP
 #define BOALANG_INTERPRETER_HPP
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "expr/expr.hpp"
+#include "interpreter/memo/memo.hpp"
+#include "interpreter/memory/memory.hpp"
+#include "interpreter/native/native.hpp"
 #include "interpreter/scope/scope.hpp"
 #include "stmt/stmt.hpp"
 #include "utils/errors.hpp"
 
+static constexpr std::uint64_t DEADLINE_CHECK_INTERVAL =
+    1024; /**< Steps between reads of the clock when timeout is set. */
+
+/**
+ * @brief Bounds of a single visited program, unlimited by default.
+ *
+ * Steps are loop iterations and function calls, checked before each of them.
+ */
+struct ExecutionLimits {
+  std::optional<std::uint64_t> max_steps;
+  std::optional<std::chrono::milliseconds> timeout; /**< Time spent running,
+                                                       not yielded. */
+  std::optional<std::uint64_t> slice_steps; /**< Steps between calls of yield
+                                               handler. */
+};
+
 /**
  * @brief Interprets statements and expressions.
  */
 class Interpreter : public ExprVisitor, public StmtVisitor {
+  MemoryTracker memory_; /**< Charged by values, outlives all of them. */
   std::optional<eval_value_t> evaluation_ =
       std::nullopt; /**< Evaluated value. */
   std::vector<std::unique_ptr<Scope>>
       scopes_; /**< Vector of existing scopes. */
+  std::vector<std::unique_ptr<Scope>>
+      free_scopes_; /**< Popped scopes kept for reuse, so that blocks run in
+                       loops do not allocate a scope per iteration. */
+  std::vector<std::shared_ptr<InitalizerList>>
+      local_lists_; /**< Storage of initializer lists which do not escape
+                       the statement consuming them, reused once no longer
+                       referenced. */
   std::vector<std::unique_ptr<CallContext>>
       call_contexts_;        /**< Vector of existing call contexts. */
   bool return_flag_ = false; /**< Is currently returning from a function. */
+  std::ostream* out_;        /**< Sink of printed values. */
+  NativeRegistry natives_;   /**< Host functions, kept across reset(). */
+  ExecutionLimits limits_;
+  std::uint64_t steps_ = 0;      /**< Steps taken by visited program. */
+  std::uint64_t next_check_ = 0; /**< Limits are checked after this many
+                                    steps. */
+  std::optional<std::chrono::steady_clock::time_point> deadline_;
+  std::uint64_t next_yield_ = 0; /**< Slice ends after this many steps. */
+  std::function<void()> yield_handler_;
+
+  /**
+   * @brief Self call in tail position, run by call_func() in place of
+   * returning.
+   */
+  struct TailCall {
+    std::vector<eval_value_t> args;
+    Position position;
+  };
+  std::optional<TailCall> tail_call_;
+  std::optional<std::size_t> memo_capacity_;
+  std::vector<function_t> memoized_; /**< Functions with a cache, in order
+                                        of their first call. */
 
   static bool boolify(
       const eval_value_t& value); /**< Boolifies eval_value_t. */
@@ -40,6 +95,13 @@ class Interpreter : public ExprVisitor, public StmtVisitor {
       evaluate_var(const VisitType* visited); /**< Evaluates statements and
                            expressions, and extracts value from Variable. */
 
+  void execute(const Stmt& stmt); /**< Executes statement, reporting exceeded
+                                     memory limit at its position. */
+  void step(const Position& position); /**< Counts step of loop or call. */
+  void check_limits(const Position& position); /**< Throws if step limit or
+                                                  deadline is reached, yields
+                                                  at end of slice. */
+
   void set_evaluation(eval_value_t value);
 
   template <typename T>
@@ -50,12 +112,62 @@ class Interpreter : public ExprVisitor, public StmtVisitor {
 
   Scope* create_new_scope();
   void pop_last_scope();
+  std::shared_ptr<InitalizerList> local_list(); /**< Free list of
+                                                   local_lists_. */
 
-  void assign_init_list(
-      const VarDeclStmt* stmt, const std::shared_ptr<StructType>& type,
-      const eval_value_t& init_value); /**< Assigns init list to struct. */
+  std::shared_ptr<StructObject> make_struct(
+      const std::shared_ptr<StructType>& type, const eval_value_t& init_value,
+      bool mut, const std::string& name,
+      const Position& position); /**< Builds struct from init list. */
+  std::shared_ptr<ArrayObject> make_array(
+      const VarType& type, const eval_value_t& init_value, bool mut,
+      const std::string& name,
+      const Position& position); /**< Builds array from init list or takes
+                                    over cloned array. */
+  std::shared_ptr<MapObject> make_map(
+      const VarType& type, const eval_value_t& init_value, bool mut,
+      const std::string& name,
+      const Position& position); /**< Builds map from init list of {key,
+                                    value} pairs or takes over cloned map. */
+  eval_value_t make_container(
+      const VarType& type, const eval_value_t& init_value, bool mut,
+      const std::string& name,
+      const Position& position); /**< Builds array or map of given type. */
+  eval_value_t make_element(
+      const VarType& type, bool mut, const std::string& name,
+      const eval_value_t& value,
+      const Position& position); /**< Converts cloned value into element of
+                                    array or map. */
+  static std::size_t element_index(
+      const ArrayObject& array, const eval_value_t& index,
+      const Position& position); /**< Checks index of array element. */
+  static map_key_t map_key(
+      const MapObject& map, const eval_value_t& key,
+      const Position& position); /**< Checks type of map key. */
+  void bind_value(const std::string& name, const VarType& type,
+                  const eval_value_t& value, bool mut,
+                  const Position& position); /**< Defines variable holding
+                                                clone of value. */
 
-  void call_func(FunctionObject* func);
+  /**
+   * @brief Runs body of \p func called at \p position, including its tail
+   * calls.
+   *
+   * @return Position of the call whose body finished last.
+   */
+  Position call_func(FunctionObject* func, Position position);
+  Memo* memo_of(const function_t& func); /**< Cache of \p func, null unless
+                                            it is memoized. */
+  [[nodiscard]] bool is_pure(const FunctionObject& func,
+                             std::vector<const FunctionObject*>& visiting)
+      const; /**< Checks \p func and functions it calls for side effects,
+                assuming the \p visiting ones have none. */
+  [[nodiscard]] bool is_tail_call(
+      const ReturnStmt& stmt) const; /**< Checks whether \p stmt returns a
+                                        call of the running function. */
+  void call_native_func(const FunctionObject* func,
+                        const std::vector<eval_value_t>& args,
+                        const Position& position);
   std::vector<eval_value_t> get_call_args_values(
       const std::vector<std::unique_ptr<Expr>>&
           arguments); /**< Evaluates call args. */
@@ -68,15 +180,19 @@ class Interpreter : public ExprVisitor, public StmtVisitor {
   void make_call(const std::string& identifier, const Position& position,
                  const std::vector<std::unique_ptr<Expr>>&
                      arguments); /** Handles calling functions */
+  bool call_container_builtin(
+      const std::string& identifier, const Position& position,
+      const std::vector<std::unique_ptr<Expr>>&
+          arguments); /**< Handles size(), push(), contains() and remove() of
+                         arrays and maps, if not shadowed by other
+                         functions. */
 
   void define_variable(const std::string& name, const eval_value_t& variable);
   void define_type(const std::string& name, const types_t& type);
   void define_function(const std::string& name, const function_t& function);
-  [[nodiscard]] std::optional<eval_value_t> get_variable(
-      const std::string& name) const;
-  [[nodiscard]] std::optional<types_t> get_type(const std::string& name) const;
-  [[nodiscard]] std::optional<function_t> get_function(
-      const std::string& name) const;
+  [[nodiscard]] const eval_value_t* get_variable(const std::string& name) const;
+  [[nodiscard]] const types_t* get_type(const std::string& name) const;
+  [[nodiscard]] const function_t* get_function(const std::string& name) const;
 
   [[nodiscard]] bool match_type(const eval_value_t& actual,
                                 const VarType& expected,
@@ -90,21 +206,89 @@ class Interpreter : public ExprVisitor, public StmtVisitor {
   void perform_comparison_operation(Expr* left, Expr* right, Operation op,
                                     const Position& position);
 
-  template <typename T, typename Operation>
-  requires std::integral<T> || std::floating_point<T>
-  bool is_overflow(const T& left, const T& right, Operation);
+  template <typename Operation>
+  static int int_arithmetic(
+      int lhs, int rhs, Operation op,
+      const Position& position); /**< Checked int arithmetic using compiler
+                                    overflow builtins. */
 
-  template <typename T, typename Operation>
-  requires std::integral<T> || std::floating_point<T>
-  bool is_underflow(const T& left, const T& right, Operation);
+  template <typename Operation>
+  static float float_arithmetic(
+      float lhs, float rhs, Operation op,
+      const Position& position); /**< Checked float arithmetic. */
 
  public:
-  Interpreter() { scopes_.push_back(std::make_unique<Scope>()); };
+  /**
+   * @brief Constructs interpreter printing to \p out.
+   */
+  explicit Interpreter(std::ostream& out = std::cout) : out_(&out) {
+    scopes_.push_back(std::make_unique<Scope>());
+  };
+
+  /**
+   * @brief Drops all global state left by visited programs, keeping native
+   * functions.
+   */
+  void reset();
+
+  /**
+   * @brief Native functions callable from code. Functions defined in code
+   * take precedence over native ones with the same name, and native ones
+   * over the standard library (see standard_library()).
+   *
+   * Native functions report errors by throwing NativeError.
+   */
+  NativeRegistry& natives() { return natives_; }
+
+  /**
+   * @brief Memory held by values of visited programs, including strings,
+   * objects and scopes, with its peak and limit. Exceeding the limit raises
+   * RuntimeError at the running statement.
+   */
+  MemoryTracker& memory() { return memory_; }
+
+  /**
+   * @brief Bounds applied to each visited program. Reaching them raises
+   * RuntimeError at the loop or call about to run.
+   */
+  ExecutionLimits& limits() { return limits_; }
+
+  /**
+   * @brief Maximum results cached per pure function, memoization is off when
+   * empty. Results of pure functions depend only on their arguments, so
+   * calls with cached arguments are not run again.
+   */
+  std::optional<std::size_t>& memo_capacity() { return memo_capacity_; }
+
+  /**
+   * @brief Cache statistics of memoized functions, in order of their first
+   * call.
+   */
+  [[nodiscard]] std::vector<std::pair<std::string, MemoStats>> memo_stats()
+      const;
+
+  /**
+   * @brief Sets function called at end of each slice of steps, and by
+   * yield(). Returning from it continues the run, so a handler switching
+   * away from the running stack suspends the program.
+   */
+  void set_yield_handler(std::function<void()> handler) {
+    yield_handler_ = std::move(handler);
+  }
+
+  /**
+   * @brief Calls yield handler, if set. Time spent in it does not count
+   * towards timeout.
+   */
+  void yield();
+
   void visit(const Program& stmt) override;
   void visit(const PrintStmt& stmt) override;
   void visit(const IfStmt& stmt) override;
   void visit(const BlockStmt& stmt) override;
   void visit(const WhileStmt& stmt) override;
+  void visit(const ForStmt& stmt) override;
+  void visit(const ForRangeStmt& stmt) override;
   void visit(const VarDeclStmt& stmt) override;
   void visit(const StructFieldStmt& stmt) override;
   void visit(const StructDeclStmt& stmt) override;
@@ -139,6 +323,7 @@ class Interpreter : public ExprVisitor, public StmtVisitor {
   void visit(const InitalizerListExpr& expr) override;
   void visit(const CallExpr& expr) override;
   void visit(const FieldAccessExpr& expr) override;
+  void visit(const IndexExpr& expr) override;
 };
 
 #endif  // BOALANG_INTERPRETER_HPP
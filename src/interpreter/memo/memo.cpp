@@ -0,0 +1,185 @@
+#include "memo.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "ast/astwalker.hpp"
+
+namespace {
+
+/**
+ * @brief Collects calls made by a function body, noting statements whose
+ * effects are visible outside of it.
+ *
+ * Functions see variables of their callers, so reading a variable which is
+ * not a parameter or declared in the body depends on state of the caller.
+ */
+class PurityChecker : public ASTWalker {
+  std::vector<std::vector<std::string>> scopes_;
+  std::vector<std::string> callees_;
+  bool side_effects_ = false;
+
+  [[nodiscard]] bool declared(const std::string& name) const {
+    return std::ranges::any_of(scopes_, [&](const auto& scope) {
+      return std::ranges::find(scope, name) != scope.end();
+    });
+  }
+
+  void call(const std::string& name) {
+    if (std::ranges::find(callees_, name) == callees_.end()) {
+      callees_.push_back(name);
+    }
+  }
+
+  void walk_scoped(const std::string& name, const Stmt* body) {
+    scopes_.push_back({name});
+    walk(body);
+    scopes_.pop_back();
+  }
+
+ public:
+  std::optional<std::vector<std::string>> check(const FunctionObject& func) {
+    scopes_.emplace_back();
+    for (const auto& param : func.params) {
+      scopes_.back().push_back(param.first);
+    }
+    walk(func.body);
+    if (side_effects_) {
+      return std::nullopt;
+    }
+    return std::move(callees_);
+  }
+
+  void visit(const PrintStmt&) override { side_effects_ = true; }
+  void visit(const FuncStmt&) override { side_effects_ = true; }
+
+  void visit(const BlockStmt& stmt) override {
+    scopes_.emplace_back();
+    ASTWalker::visit(stmt);
+    scopes_.pop_back();
+  }
+
+  void visit(const ForStmt& stmt) override {
+    walk(stmt.iterable.get());
+    walk_scoped(stmt.identifier, stmt.body.get());
+  }
+
+  void visit(const ForRangeStmt& stmt) override {
+    walk(stmt.begin.get());
+    walk(stmt.end.get());
+    walk_scoped(stmt.identifier, stmt.body.get());
+  }
+
+  void visit(const LambdaFuncStmt& stmt) override {
+    walk_scoped(stmt.identifier, stmt.body.get());
+  }
+
+  void visit(const VarDeclStmt& stmt) override {
+    ASTWalker::visit(stmt);
+    scopes_.back().push_back(stmt.identifier);
+  }
+
+  void visit(const CallStmt& stmt) override {
+    call(stmt.identifier);
+    ASTWalker::visit(stmt);
+  }
+
+  // inlined calls only compute their arguments, the callee may be removed
+  void visit(const CallExpr& expr) override {
+    if (!expr.inlined) {
+      call(expr.identifier);
+    }
+    ASTWalker::visit(expr);
+  }
+
+  void visit(const VarExpr& expr) override {
+    if (!declared(expr.identifier)) {
+      side_effects_ = true;
+    }
+  }
+};
+
+}  // namespace
+
+std::optional<std::vector<std::string>> pure_body_callees(
+    const FunctionObject& func) {
+  return PurityChecker().check(func);
+}
+
+bool is_memoizable(const FunctionObject& func) {
+  auto key_type = [](const VarType& type) {
+    return type.type == INT || type.type == BOOL || type.type == STR;
+  };
+  return func.body != nullptr &&
+         (key_type(func.return_type) || func.return_type.type == FLOAT) &&
+         std::ranges::all_of(func.params, [&](const auto& param) {
+           return key_type(param.second);
+         });
+}
+
+double MemoStats::hit_rate() const {
+  auto lookups = hits + misses;
+  return lookups == 0
+             ? 0.
+             : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+std::size_t Memo::KeyHash::operator()(const key_t& key) const {
+  std::size_t hash = key.size();
+  for (const auto& arg : key) {
+    hash ^= hash_key(arg) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+  return hash;
+}
+
+std::size_t Memo::entry_size(const key_t& key) const {
+  // result node with its key, and the key's copy in order_
+  return 2 * (sizeof(key_t) + key.size() * sizeof(map_key_t)) +
+         sizeof(eval_value_t) + 2 * sizeof(void*);
+}
+
+Memo::key_t Memo::key(const std::vector<eval_value_t>& args) {
+  key_t key;
+  key.reserve(args.size());
+  for (const auto& arg : args) {
+    if (const auto* str = std::get_if<StrValue>(&arg)) {
+      key.emplace_back(*str);
+    } else if (const auto* boolean = std::get_if<bool>(&arg)) {
+      key.emplace_back(static_cast<int>(*boolean));
+    } else {
+      key.emplace_back(std::get<int>(arg));
+    }
+  }
+  return key;
+}
+
+const eval_value_t* Memo::find(const key_t& key) {
+  auto found = results_.find(key);
+  if (found == results_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+  ++stats_.hits;
+  return &found->second;
+}
+
+void Memo::insert(key_t key, eval_value_t result) {
+  if (capacity_ == 0) {
+    return;
+  }
+  if (results_.size() >= capacity_) {
+    memory_.resize(memory_.bytes() - entry_size(order_.front()));
+    results_.erase(order_.front());
+    order_.pop_front();
+    ++stats_.evictions;
+  }
+  memory_.resize(memory_.bytes() + entry_size(key));
+  order_.push_back(key);
+  results_.emplace(std::move(key), std::move(result));
+}
+
+MemoStats Memo::stats() const {
+  MemoStats stats = stats_;
+  stats.entries = results_.size();
+  return stats;
+}
@@ -0,0 +1,97 @@
+/*! @file memo.hpp
+    @brief boalang interpreter's memoization of pure functions.
+*/
+
+#ifndef BOALANG_MEMO_HPP
+#define BOALANG_MEMO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "interpreter/hashmap/hashmap.hpp"
+#include "interpreter/memory/memory.hpp"
+#include "interpreter/scope/scope.hpp"
+
+static constexpr std::size_t DEFAULT_MEMO_CAPACITY =
+    4096; /**< Results cached per function by default. */
+
+/**
+ * @brief Finds functions called by body of \p func.
+ *
+ * @return Names of called functions, none if the body has side effects of
+ * its own: prints, uses variables it did not declare or defines functions.
+ */
+std::optional<std::vector<std::string>> pure_body_callees(
+    const FunctionObject& func);
+
+/**
+ * @brief Checks whether types of \p func let its results be cached: bool,
+ * int or str parameters and a value of builtin type returned.
+ */
+bool is_memoizable(const FunctionObject& func);
+
+/**
+ * @brief Lookups of one function's cache.
+ */
+struct MemoStats {
+  std::uint64_t hits = 0;
+  std::uint64_t misses = 0;
+  std::uint64_t evictions = 0;
+  std::size_t entries = 0;
+
+  [[nodiscard]] double hit_rate() const;
+};
+
+/**
+ * @brief Results of a pure function by its arguments.
+ *
+ * Holds at most capacity results, evicting the oldest one when full.
+ */
+class Memo {
+ public:
+  using key_t = std::vector<map_key_t>; /**< Arguments of a call. */
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const key_t& key) const;
+  };
+
+  std::unordered_map<key_t, eval_value_t, KeyHash> results_;
+  std::deque<key_t> order_; /**< Keys of results_ from the oldest. */
+  std::size_t capacity_;
+  MemoStats stats_;
+  MemoryCharge memory_; /**< Estimate of results and their keys. */
+
+  [[nodiscard]] std::size_t entry_size(const key_t& key) const;
+
+ public:
+  explicit Memo(std::size_t capacity) : capacity_(capacity) {}
+
+  /**
+   * @brief Converts arguments of memoizable function into a key.
+   */
+  static key_t key(const std::vector<eval_value_t>& args);
+
+  /**
+   * @return Result cached for \p key, null if there is none. Counted as a
+   * hit or a miss.
+   */
+  [[nodiscard]] const eval_value_t* find(const key_t& key);
+
+  /**
+   * @brief Caches \p result for \p key, missing before.
+   *
+   * @throws MemoryLimitError When the entry would exceed memory limit, it is
+   * not cached then.
+   */
+  void insert(key_t key, eval_value_t result);
+
+  [[nodiscard]] MemoStats stats() const;
+};
+
+#endif  // BOALANG_MEMO_HPP
@@ -0,0 +1,29 @@
+#include "memory.hpp"
+
+#include <string>
+
+namespace {
+
+thread_local MemoryTracker* active_tracker = nullptr;
+
+}  // namespace
+
+void MemoryTracker::allocate(std::size_t bytes) {
+  if (live_ > limit_ || bytes > limit_ - live_) {
+    throw MemoryLimitError("Memory limit of " + std::to_string(limit_) +
+                           " bytes exceeded");
+  }
+  live_ += bytes;
+  if (live_ > peak_) {
+    peak_ = live_;
+  }
+}
+
+MemoryTracker* MemoryTracker::active() { return active_tracker; }
+
+ActiveTracker::ActiveTracker(MemoryTracker& tracker)
+    : previous_(active_tracker) {
+  active_tracker = &tracker;
+}
+
+ActiveTracker::~ActiveTracker() { active_tracker = previous_; }
@@ -0,0 +1,146 @@
+/*! @file memory.hpp
+    @brief boalang interpreter's memory accounting.
+*/
+
+#ifndef BOALANG_MEMORY_HPP
+#define BOALANG_MEMORY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Raised when a charge would exceed memory limit, reported by the
+ * interpreter as RuntimeError at the running statement.
+ */
+class MemoryLimitError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Counts bytes held by values of one interpreter.
+ *
+ * Values are charged with an estimate of their footprint: objects, strings
+ * stored outside of values and scope entries, not the exact heap usage.
+ */
+class MemoryTracker {
+  std::size_t live_ = 0;
+  std::size_t peak_ = 0;
+  std::size_t limit_ = std::numeric_limits<std::size_t>::max();
+
+ public:
+  /**
+   * @brief Adds \p bytes to live memory.
+   *
+   * @throws MemoryLimitError When live memory would exceed the limit, the
+   * bytes are not added then.
+   */
+  void allocate(std::size_t bytes);
+
+  /**
+   * @brief Subtracts \p bytes from live memory.
+   */
+  void release(std::size_t bytes) noexcept { live_ -= bytes; }
+
+  [[nodiscard]] std::size_t live() const { return live_; }
+  [[nodiscard]] std::size_t peak() const { return peak_; }
+  [[nodiscard]] std::size_t limit() const { return limit_; }
+
+  /**
+   * @brief Sets maximum of live bytes, unlimited by default. Memory already
+   * held is not checked until the next allocation.
+   */
+  void set_limit(std::size_t limit) { limit_ = limit; }
+
+  /**
+   * @return Tracker charged by values constructed on this thread, null if
+   * none is active.
+   */
+  [[nodiscard]] static MemoryTracker* active();
+};
+
+/**
+ * @brief Makes a tracker active on this thread for its lifetime, restoring
+ * the previous one afterwards.
+ */
+class ActiveTracker {
+  MemoryTracker* previous_;
+
+ public:
+  explicit ActiveTracker(MemoryTracker& tracker);
+  ~ActiveTracker();
+
+  ActiveTracker(const ActiveTracker&) = delete;
+  ActiveTracker& operator=(const ActiveTracker&) = delete;
+};
+
+/**
+ * @brief Bytes charged to a tracker, released on destruction.
+ *
+ * Charges are taken from the active tracker when constructed, copies charge
+ * the same tracker again and moves transfer the charge. Without a tracker
+ * nothing is counted.
+ */
+class MemoryCharge {
+  MemoryTracker* tracker_;
+  std::size_t bytes_ = 0;
+
+ public:
+  /**
+   * @brief Charges \p bytes to the active tracker.
+   */
+  explicit MemoryCharge(std::size_t bytes = 0)
+      : tracker_(MemoryTracker::active()) {
+    resize(bytes);
+  }
+
+  MemoryCharge(const MemoryCharge& other) : tracker_(other.tracker_) {
+    resize(other.bytes_);
+  }
+
+  MemoryCharge(MemoryCharge&& other) noexcept
+      : tracker_(other.tracker_), bytes_(std::exchange(other.bytes_, 0)) {}
+
+  MemoryCharge& operator=(const MemoryCharge& other) {
+    if (this != &other) {
+      MemoryCharge copy(other);
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  MemoryCharge& operator=(MemoryCharge&& other) noexcept {
+    if (this != &other) {
+      resize(0);
+      tracker_ = other.tracker_;
+      bytes_ = std::exchange(other.bytes_, 0);
+    }
+    return *this;
+  }
+
+  ~MemoryCharge() { resize(0); }
+
+  /**
+   * @brief Changes charge to \p bytes.
+   *
+   * @throws MemoryLimitError When growing over the limit, the charge is left
+   * unchanged then.
+   */
+  void resize(std::size_t bytes) {
+    if (tracker_ == nullptr) {
+      return;
+    }
+    if (bytes > bytes_) {
+      tracker_->allocate(bytes - bytes_);
+    } else {
+      tracker_->release(bytes_ - bytes);
+    }
+    bytes_ = bytes;
+  }
+
+  [[nodiscard]] std::size_t bytes() const { return bytes_; }
+};
+
+#endif  // BOALANG_MEMORY_HPP
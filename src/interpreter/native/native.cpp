@@ -0,0 +1,12 @@
+#include "native.hpp"
+
+void NativeRegistry::define(const function_t& function) {
+  functions_.insert_or_assign(function->identifier, function);
+}
+
+const function_t* NativeRegistry::find(const std::string& name) const {
+  if (auto it = functions_.find(name); it != functions_.end()) {
+    return &it->second;
+  }
+  return nullptr;
+}
@@ -0,0 +1,151 @@
+/*! @file native.hpp
+    @brief Native functions callable from boalang code.
+*/
+
+#ifndef BOALANG_NATIVE_HPP
+#define BOALANG_NATIVE_HPP
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "interpreter/scope/scope.hpp"
+
+/**
+ * @brief Conversions between C++ parameter or return type \p T and
+ * eval_value_t of corresponding builtin type.
+ *
+ * Parameters of type std::string_view or const StrValue& view the argument
+ * held by the interpreter for the duration of the call, without copying.
+ */
+template <typename T>
+struct NativeType;
+
+template <>
+struct NativeType<int> {
+  static constexpr BuiltinType type = INT;
+  static int from(const eval_value_t& value) { return std::get<int>(value); }
+  static eval_value_t to(int value) { return value; }
+};
+
+template <>
+struct NativeType<float> {
+  static constexpr BuiltinType type = FLOAT;
+  static float from(const eval_value_t& value) {
+    return std::get<float>(value);
+  }
+  static eval_value_t to(float value) { return value; }
+};
+
+template <>
+struct NativeType<bool> {
+  static constexpr BuiltinType type = BOOL;
+  static bool from(const eval_value_t& value) { return std::get<bool>(value); }
+  static eval_value_t to(bool value) { return value; }
+};
+
+template <>
+struct NativeType<StrValue> {
+  static constexpr BuiltinType type = STR;
+  static const StrValue& from(const eval_value_t& value) {
+    return std::get<StrValue>(value);
+  }
+  static eval_value_t to(StrValue value) { return value; }
+};
+
+template <>
+struct NativeType<std::string_view> {
+  static constexpr BuiltinType type = STR;
+  static std::string_view from(const eval_value_t& value) {
+    return std::get<StrValue>(value).view();
+  }
+  static eval_value_t to(std::string_view value) { return StrValue(value); }
+};
+
+template <>
+struct NativeType<std::string> {
+  static constexpr BuiltinType type = STR;
+  static std::string from(const eval_value_t& value) {
+    return std::get<StrValue>(value).str();
+  }
+  static eval_value_t to(std::string value) {
+    return StrValue(std::move(value));
+  }
+};
+
+/**
+ * @brief Builds FunctionObject calling typed C++ function.
+ */
+template <typename Signature>
+struct NativeAdapter;
+
+template <typename R, typename... Args>
+struct NativeAdapter<std::function<R(Args...)>> {
+  template <typename F>
+  static function_t make(std::string name, F function) {
+    std::vector<std::pair<std::string, VarType>> params;
+    (params.emplace_back("arg" + std::to_string(params.size()),
+                         VarType(NativeType<std::decay_t<Args>>::type)),
+     ...);
+    VarType return_type(VOID);
+    if constexpr (!std::is_void_v<R>) {
+      return_type = VarType(NativeType<std::decay_t<R>>::type);
+    }
+    return std::make_shared<FunctionObject>(
+        std::move(name), std::move(return_type), std::move(params),
+        native_function_t(
+            [function = std::move(function)](
+                const std::vector<eval_value_t>& args) -> eval_value_t {
+              return call(function, args, std::index_sequence_for<Args...>{});
+            }));
+  }
+
+ private:
+  template <typename F, std::size_t... I>
+  static eval_value_t call(const F& function,
+                           const std::vector<eval_value_t>& args,
+                           std::index_sequence<I...>) {
+    if constexpr (std::is_void_v<R>) {
+      function(NativeType<std::decay_t<Args>>::from(args[I])...);
+      return std::monostate{};
+    } else {
+      return NativeType<std::decay_t<R>>::to(
+          function(NativeType<std::decay_t<Args>>::from(args[I])...));
+    }
+  }
+};
+
+/**
+ * @brief Native functions by name.
+ */
+class NativeRegistry {
+  std::map<std::string, function_t> functions_;
+
+ public:
+  /**
+   * @brief Registers \p function, replacing one with the same name.
+   */
+  void define(const function_t& function);
+
+  /**
+   * @brief Registers typed C++ \p function as \p name.
+   *
+   * Parameter and return types are derived from its signature, see
+   * NativeType. Arguments are checked against them before the call.
+   */
+  template <typename F>
+  void define(std::string name, F function) {
+    define(NativeAdapter<decltype(std::function{function})>::make(
+        std::move(name), std::move(function)));
+  }
+
+  /**
+   * @brief Gets function by \p name, null if not registered.
+   */
+  [[nodiscard]] const function_t* find(const std::string& name) const;
+};
+
+#endif  // BOALANG_NATIVE_HPP
@@ -0,0 +1,78 @@
+#include "stdlib.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+
+#include "utils/errors.hpp"
+
+namespace {
+
+int checked_size(std::size_t size) {
+  if (size > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    throw NativeError("Detected overflow");
+  }
+  return static_cast<int>(size);
+}
+
+NativeRegistry make_standard_library() {
+  NativeRegistry library;
+
+  library.define("abs", [](int value) {
+    if (value == std::numeric_limits<int>::min()) {
+      throw NativeError("Detected overflow");
+    }
+    return value < 0 ? -value : value;
+  });
+  library.define("min", [](int lhs, int rhs) { return std::min(lhs, rhs); });
+  library.define("max", [](int lhs, int rhs) { return std::max(lhs, rhs); });
+  library.define("pow", [](float base, float exponent) {
+    float result = std::pow(base, exponent);
+    if (std::isinf(result)) {
+      throw NativeError("Detected overflow");
+    }
+    if (std::isnan(result)) {
+      throw NativeError("Power undefined");
+    }
+    return result;
+  });
+  library.define("sqrt", [](float value) {
+    if (value < 0) {
+      throw NativeError("Square root of negative number");
+    }
+    return std::sqrt(value);
+  });
+
+  library.define("len",
+                 [](std::string_view str) { return checked_size(str.size()); });
+  library.define("substr", [](std::string_view str, int start, int length) {
+    if (start < 0 || static_cast<std::size_t>(start) > str.size()) {
+      throw NativeError("Substring start out of range");
+    }
+    if (length < 0) {
+      throw NativeError("Negative substring length");
+    }
+    return str.substr(static_cast<std::size_t>(start),
+                      static_cast<std::size_t>(length));
+  });
+  library.define("find", [](std::string_view str, std::string_view needle) {
+    std::size_t index = str.find(needle);
+    return index == std::string_view::npos ? -1 : checked_size(index);
+  });
+  library.define("to_upper", [](std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) {
+      return static_cast<char>(std::toupper(c));
+    });
+    return str;
+  });
+
+  return library;
+}
+
+}  // namespace
+
+const NativeRegistry& standard_library() {
+  static const NativeRegistry library = make_standard_library();
+  return library;
+}
@@ -0,0 +1,22 @@
+/*! @file stdlib.hpp
+    @brief Standard library of native functions.
+*/
+
+#ifndef BOALANG_STDLIB_HPP
+#define BOALANG_STDLIB_HPP
+
+#include "interpreter/native/native.hpp"
+
+/**
+ * @brief Gets registry of builtin functions available to every program.
+ *
+ * - int abs(int), int min(int, int), int max(int, int)
+ * - float pow(float, float), float sqrt(float)
+ * - int len(str), str substr(str s, int start, int length),
+ *   int find(str s, str needle) (-1 if not found), str to_upper(str)
+ *
+ * Built once and shared, read-only, by all interpreters.
+ */
+const NativeRegistry& standard_library();
+
+#endif  // BOALANG_STDLIB_HPP
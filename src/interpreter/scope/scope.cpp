@@ -3,6 +3,47 @@
 #include <algorithm>
 #include <functional>
 
+namespace {
+
+/**
+ * @return Whether values of \p type are stored as objects, which have to be
+ * cloned and carry mutability.
+ */
+bool is_object_type(const VarType& type) {
+  return type.type == IDENTIFIER || type.type == ARRAY || type.type == MAP;
+}
+
+void set_object_mut(const eval_value_t& object, bool value) {
+  std::visit(overloaded{
+                 [value](const std::shared_ptr<ArrayObject>& arg) {
+                   arg->set_mut(value);
+                 },
+                 [value](const std::shared_ptr<MapObject>& arg) {
+                   arg->set_mut(value);
+                 },
+                 [value](const std::shared_ptr<StructObject>& arg) {
+                   arg->mut = value;
+                 },
+                 [value](const std::shared_ptr<VariantObject>& arg) {
+                   arg->mut = value;
+                 },
+                 [](const auto&) {},
+             },
+             object);
+}
+
+/**
+ * @return Estimated size of map node holding entry \p name of type \p V:
+ * the pair, tree links and color, and characters of the name.
+ */
+template <typename V>
+std::size_t entry_size(const std::string& name) {
+  return sizeof(std::pair<const std::string, V>) + 4 * sizeof(void*) +
+         name.size();
+}
+
+}  // namespace
+
 bool Scope::type_in_variant(const std::vector<VarType>& variant_types,
                             BuiltinType type) {
   return std::ranges::any_of(variant_types, [&type](const VarType& param) {
@@ -34,7 +75,7 @@ bool Scope::match_type(const eval_value_t& actual, const VarType& expected,
         overloaded{
             [&expected](int) { return expected.type == INT; },
             [&expected](float) { return expected.type == FLOAT; },
-            [&expected](const std::string&) { return expected.type == STR; },
+            [&expected](const StrValue&) { return expected.type == STR; },
             [&expected](bool) { return expected.type == BOOL; },
             [&expected](const std::shared_ptr<Variable>& arg) {
               return arg->type.name == expected.name;
@@ -42,6 +83,14 @@ bool Scope::match_type(const eval_value_t& actual, const VarType& expected,
             [&expected](const std::shared_ptr<StructObject>& arg) {
               return arg->type_def->type_name == expected.name;
             },
+            [&expected](const std::shared_ptr<ArrayObject>& arg) {
+              return expected.type == ARRAY &&
+                     arg->element_type == *expected.element;
+            },
+            [&expected](const std::shared_ptr<MapObject>& arg) {
+              return expected.type == MAP && arg->key_type == *expected.key &&
+                     arg->value_type == *expected.element;
+            },
             [&](const std::shared_ptr<VariantObject>& arg) {
               return arg->type_def->type_name == expected.name ||
                      check(arg->contained);
@@ -53,53 +102,63 @@ bool Scope::match_type(const eval_value_t& actual, const VarType& expected,
   return check(actual);
 }
 
+void Scope::reset(Scope* enclosing) {
+  variables_.clear();
+  types_.clear();
+  functions_.clear();
+  enclosing_ = enclosing;
+  memory_.resize(sizeof(Scope));
+}
+
 void Scope::define_variable(const std::string& name, eval_value_t variable) {
-  variables_.insert({name, std::move(variable)});
+  if (variables_.insert({name, std::move(variable)}).second) {
+    memory_.resize(memory_.bytes() + entry_size<eval_value_t>(name));
+  }
 }
 
 const std::map<std::string, eval_value_t>& Scope::get_variables() const {
   return variables_;
 }
 
-std::optional<eval_value_t> Scope::get_variable(const std::string& name) const {
-  auto item = variables_.find(name);
-  if (item != variables_.end()) {
-    return item->second;
-  }
-  if (enclosing_ != nullptr) {
-    return enclosing_->get_variable(name);
+const eval_value_t* Scope::get_variable(const std::string& name) const {
+  for (const Scope* scope = this; scope != nullptr; scope = scope->enclosing_) {
+    if (auto item = scope->variables_.find(name);
+        item != scope->variables_.end()) {
+      return &item->second;
+    }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
-std::optional<types_t> Scope::get_type(const std::string& name) const {
-  auto item = types_.find(name);
-  if (item != types_.end()) {
-    return item->second;
-  }
-  if (enclosing_ != nullptr) {
-    return enclosing_->get_type(name);
+const types_t* Scope::get_type(const std::string& name) const {
+  for (const Scope* scope = this; scope != nullptr; scope = scope->enclosing_) {
+    if (auto item = scope->types_.find(name); item != scope->types_.end()) {
+      return &item->second;
+    }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
-std::optional<function_t> Scope::get_function(const std::string& name) const {
-  auto item = functions_.find(name);
-  if (item != functions_.end()) {
-    return item->second;
-  }
-  if (enclosing_ != nullptr) {
-    return enclosing_->get_function(name);
+const function_t* Scope::get_function(const std::string& name) const {
+  for (const Scope* scope = this; scope != nullptr; scope = scope->enclosing_) {
+    if (auto item = scope->functions_.find(name);
+        item != scope->functions_.end()) {
+      return &item->second;
+    }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
 void Scope::define_type(const std::string& name, types_t type) {
-  types_.insert({name, std::move(type)});
+  if (types_.insert({name, std::move(type)}).second) {
+    memory_.resize(memory_.bytes() + entry_size<types_t>(name));
+  }
 }
 
 void Scope::define_function(const std::string& name, function_t function) {
-  functions_.insert({name, std::move(function)});
+  if (functions_.insert({name, std::move(function)}).second) {
+    memory_.resize(memory_.bytes() + entry_size<function_t>(name));
+  }
 }
 bool Scope::is_in_variant(const eval_value_t& actual, const VarType& expected,
                           bool check_self) const {
@@ -111,7 +170,7 @@ bool Scope::is_in_variant(const eval_value_t& actual, const VarType& expected,
             overloaded{[&](std::monostate) {
                          return type_in_variant(variant->get()->types, VOID);
                        },
-                       [&](const std::string&) {
+                       [&](const StrValue&) {
                          return type_in_variant(variant->get()->types, STR);
                        },
                        [&](int) {
@@ -137,6 +196,21 @@ bool Scope::is_in_variant(const eval_value_t& actual, const VarType& expected,
                                     obj->type_def->type_name) ||
                                 obj->type_def->type_name == expected.name;
                        },
+                       [&](const std::shared_ptr<ArrayObject>& obj) {
+                         return std::ranges::any_of(
+                             variant->get()->types, [&](const VarType& param) {
+                               return param.type == ARRAY &&
+                                      *param.element == obj->element_type;
+                             });
+                       },
+                       [&](const std::shared_ptr<MapObject>& obj) {
+                         return std::ranges::any_of(
+                             variant->get()->types, [&](const VarType& param) {
+                               return param.type == MAP &&
+                                      *param.key == obj->key_type &&
+                                      *param.element == obj->value_type;
+                             });
+                       },
                        [](auto) { return false; }},
             actual);
       }
@@ -160,6 +234,57 @@ StructObject StructObject::clone() const {
   return {type_def, mut, name, clone_scope()};
 }
 
+ArrayObject ArrayObject::clone() const {
+  if (!is_object_type(element_type)) {
+    return {element_type, mut, name, elements};
+  }
+  std::vector<eval_value_t> cloned;
+  cloned.reserve(elements.size());
+  for (const auto& element : elements) {
+    cloned.push_back(clone_value(element));
+  }
+  return {element_type, mut, name, std::move(cloned)};
+}
+
+void ArrayObject::update_memory() {
+  memory.resize(sizeof(ArrayObject) +
+                elements.capacity() * sizeof(eval_value_t));
+}
+
+void ArrayObject::set_mut(bool value) {
+  mut = value;
+  if (!is_object_type(element_type)) {
+    return;
+  }
+  for (const auto& element : elements) {
+    set_object_mut(element, value);
+  }
+}
+
+MapObject MapObject::clone() const {
+  MapObject cloned = *this;
+  if (is_object_type(value_type)) {
+    cloned.entries.for_each([](const map_key_t&, eval_value_t& value) {
+      value = clone_value(value);
+    });
+  }
+  return cloned;
+}
+
+void MapObject::update_memory() {
+  memory.resize(sizeof(MapObject) + entries.memory_usage());
+}
+
+void MapObject::set_mut(bool value) {
+  mut = value;
+  if (!is_object_type(value_type)) {
+    return;
+  }
+  entries.for_each([value](const map_key_t&, const eval_value_t& element) {
+    set_object_mut(element, value);
+  });
+}
+
 Scope StructObject::clone_scope() const {
   Scope new_scope;
   const auto& variables = scope.get_variables();
@@ -183,11 +308,22 @@ eval_value_t clone_value(const eval_value_t& value) {
                           cloned =
                               std::make_shared<VariantObject>(obj->clone());
                         },
+                        [&](const std::shared_ptr<ArrayObject>& obj) {
+                          cloned = std::make_shared<ArrayObject>(obj->clone());
+                        },
+                        [&](const std::shared_ptr<MapObject>& obj) {
+                          cloned = std::make_shared<MapObject>(obj->clone());
+                        },
                         [&](auto arg) { cloned = arg; }},
              value);
   return cloned;
 }
 
 eval_value_t convert_to_eval_value(const value_t& value) {
-  return std::visit([](auto&& arg) -> eval_value_t { return arg; }, value);
+  return std::visit(
+      overloaded{
+          [](const std::string& arg) -> eval_value_t { return StrValue(arg); },
+          [](auto&& arg) -> eval_value_t { return arg; },
+      },
+      value);
 }
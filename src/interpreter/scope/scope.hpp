@@ -5,6 +5,7 @@
 #ifndef BOALANG_SCOPE_HPP
 #define BOALANG_SCOPE_HPP
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -13,6 +14,9 @@
 #include <variant>
 #include <vector>
 
+#include "interpreter/hashmap/hashmap.hpp"
+#include "interpreter/memory/memory.hpp"
+#include "interpreter/strvalue/strvalue.hpp"
 #include "stmt/stmt.hpp"
 #include "token/token.hpp"
 #include "utils/errors.hpp"
@@ -25,20 +29,28 @@ static constexpr unsigned int MAX_RECURSION_DEPTH =
 struct Variable;
 struct StructObject;
 struct VariantObject;
+struct ArrayObject;
+struct MapObject;
 struct InitalizerList;
 struct FunctionObject;
 struct StructType;
+class Memo;
 struct VariantType;
 
 using eval_value_t =
-    std::variant<std::monostate, std::string, int, float, bool,
+    std::variant<std::monostate, StrValue, int, float, bool,
                  std::shared_ptr<StructObject>, std::shared_ptr<VariantObject>,
-                 std::shared_ptr<Variable>,
-                 std::shared_ptr<InitalizerList>>; /**< Possible values returned
-                                                      from evaluation_. */
+                 std::shared_ptr<Variable>, std::shared_ptr<InitalizerList>,
+                 std::shared_ptr<ArrayObject>,
+                 std::shared_ptr<MapObject>>; /**< Possible values returned
+                                                 from evaluation_. */
 
 using function_t = std::shared_ptr<FunctionObject>; /**< Callable objects. */
 
+using native_function_t = std::function<eval_value_t(
+    const std::vector<eval_value_t>&)>; /**< Functions implemented by host
+                                           application. */
+
 using types_t =
     std::variant<std::shared_ptr<StructType>,
                  std::shared_ptr<VariantType>>; /**< Types declared in code. */
@@ -63,6 +75,7 @@ class Scope {
   std::map<std::string, function_t>
       functions_{};  /**< Functions defined in scope. */
   Scope* enclosing_; /**< Parent Scope. */
+  MemoryCharge memory_{sizeof(Scope)}; /**< Scope and its entries. */
 
   [[nodiscard]] bool is_in_variant(const eval_value_t& actual,
                                    const VarType& expected,
@@ -79,6 +92,12 @@ class Scope {
    */
   Scope(Scope* enclosing) : enclosing_(enclosing){};
 
+  /**
+   * @brief Removes everything defined in the scope and attaches it to
+   * \p enclosing, so that the object can be reused.
+   */
+  void reset(Scope* enclosing);
+
   /**
    * @brief Defines new variable in current scope.
    */
@@ -101,21 +120,19 @@ class Scope {
       const;
 
   /**
-   * @brief Gets variable from current scope.
+   * @brief Gets variable from current scope, null if not defined.
    */
-  [[nodiscard]] std::optional<eval_value_t> get_variable(
-      const std::string& name) const;
+  [[nodiscard]] const eval_value_t* get_variable(const std::string& name) const;
 
   /**
-   * @brief Gets type from current scope.
+   * @brief Gets type from current scope, null if not defined.
    */
-  [[nodiscard]] std::optional<types_t> get_type(const std::string& name) const;
+  [[nodiscard]] const types_t* get_type(const std::string& name) const;
 
   /**
-   * @brief Gets function from current scope.
+   * @brief Gets function from current scope, null if not defined.
    */
-  [[nodiscard]] std::optional<function_t> get_function(
-      const std::string& name) const;
+  [[nodiscard]] const function_t* get_function(const std::string& name) const;
 
   /**
    * @brief Match type of eval_value_t actual against types declared in current
@@ -147,6 +164,7 @@ struct Variable {
   std::string name;
   bool mut; /**< Is mutable. */
   std::optional<eval_value_t> value;
+  MemoryCharge memory{sizeof(Variable)};
 
   /**
    * @brief Constructs a new Variable with eval_value_t value.
@@ -195,6 +213,7 @@ struct VariantObject {
   bool mut;              /**< Is mutable. */
   std::string name;
   eval_value_t contained; /**< Value currently contained in variant object. */
+  MemoryCharge memory{sizeof(VariantObject)};
 
   VariantObject(VariantType* type_def, bool mut, std::string name,
                 eval_value_t contained)
@@ -224,6 +243,7 @@ struct StructObject {
   bool mut;             /**< Is mutable. */
   std::string name;
   Scope scope; /**< Scope containing fields (variables). */
+  MemoryCharge memory{sizeof(StructObject)};
 
   StructObject(StructType* type_def, bool mut, std::string name, Scope scope)
       : type_def(type_def),
@@ -239,6 +259,78 @@ struct StructObject {
   [[nodiscard]] Scope clone_scope() const;
 };
 
+/**
+ * @brief Array object representation.
+ *
+ * Elements are stored by value, contiguously. Elements of struct, variant and
+ * array types are objects with the same mutability as the array.
+ */
+struct ArrayObject {
+  VarType element_type;
+  bool mut; /**< Is mutable. */
+  std::string name;
+  std::vector<eval_value_t> elements;
+  MemoryCharge memory; /**< Object and capacity of elements. */
+
+  ArrayObject(VarType element_type, bool mut, std::string name,
+              std::vector<eval_value_t> elements)
+      : element_type(std::move(element_type)),
+        mut(mut),
+        name(std::move(name)),
+        elements(std::move(elements)) {
+    update_memory();
+  };
+
+  [[nodiscard]] ArrayObject clone() const;
+
+  /**
+   * @brief Charges memory for current capacity of elements, called after
+   * they grow.
+   */
+  void update_memory();
+
+  /**
+   * @brief Sets mutability of the array and objects it holds.
+   */
+  void set_mut(bool value);
+};
+
+/**
+ * @brief Map object representation.
+ *
+ * Values of struct, variant, array and map types are objects with the same
+ * mutability as the map.
+ */
+struct MapObject {
+  VarType key_type;
+  VarType value_type;
+  bool mut; /**< Is mutable. */
+  std::string name;
+  HashMap<eval_value_t> entries;
+  MemoryCharge memory; /**< Object and storage of entries. */
+
+  MapObject(VarType key_type, VarType value_type, bool mut, std::string name)
+      : key_type(std::move(key_type)),
+        value_type(std::move(value_type)),
+        mut(mut),
+        name(std::move(name)) {
+    update_memory();
+  };
+
+  [[nodiscard]] MapObject clone() const;
+
+  /**
+   * @brief Charges memory for current storage of entries, called after they
+   * grow.
+   */
+  void update_memory();
+
+  /**
+   * @brief Sets mutability of the map and objects it holds.
+   */
+  void set_mut(bool value);
+};
+
 /**
  * @brief Function object representation.
  */
@@ -247,7 +339,16 @@ struct FunctionObject {
   VarType return_type;
   std::vector<std::pair<std::string, VarType>>
       params;      /**< Function's parameters. */
-  BlockStmt* body; /**< Pointer to function's body. */
+  BlockStmt* body; /**< Pointer to function's body, null for native ones. */
+  native_function_t native; /**< Host implementation of native function. */
+  std::vector<const ReturnStmt*>
+      tail_calls; /**< Returns of calls to function's own name, found when
+                     it is defined. */
+  std::shared_ptr<Memo> memo; /**< Cached results, set on the first call
+                                 when function is pure and memoization is
+                                 enabled. */
+  bool memo_checked = false;  /**< Whether function was considered for
+                                 memoization. */
 
   FunctionObject(std::string identifier, VarType return_type,
                  std::vector<std::pair<std::string, VarType>> params,
@@ -256,6 +357,19 @@ struct FunctionObject {
         return_type(std::move(return_type)),
         params(std::move(params)),
         body(body){};
+
+  /**
+   * @brief Constructs a native function, receiving arguments already checked
+   * against \p params and returning std::monostate if \p return_type is VOID.
+   */
+  FunctionObject(std::string identifier, VarType return_type,
+                 std::vector<std::pair<std::string, VarType>> params,
+                 native_function_t native)
+      : identifier(std::move(identifier)),
+        return_type(std::move(return_type)),
+        params(std::move(params)),
+        body(nullptr),
+        native(std::move(native)){};
 };
 
 /**
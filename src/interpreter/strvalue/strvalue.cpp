@@ -0,0 +1,110 @@
+#include "strvalue.hpp"
+
+#include <algorithm>
+
+#include "interpreter/memory/memory.hpp"
+
+/**
+ * @brief Characters shared by string values, with charge for its capacity.
+ */
+struct StrValue::Buffer {
+  std::string data;
+  MemoryCharge memory;
+
+  Buffer() : Buffer(std::string()){};
+
+  explicit Buffer(std::string data) : data(std::move(data)) {
+    memory.resize(sizeof(Buffer) + this->data.capacity());
+  }
+
+  /**
+   * @brief Grows capacity to at least \p size, doubling it to keep appends
+   * amortized. Charged before allocating, so that exceeding the limit leaves
+   * the buffer intact.
+   */
+  void reserve(std::size_t size) {
+    if (size <= data.capacity()) {
+      return;
+    }
+    auto capacity = std::max(size, data.capacity() * 2);
+    memory.resize(sizeof(Buffer) + capacity);
+    data.reserve(capacity);
+  }
+};
+
+StrValue::StrValue(std::string_view str) {
+  if (str.size() <= INLINE_CAPACITY) {
+    Inline small{};
+    std::copy(str.begin(), str.end(), small.data.begin());
+    small.size = static_cast<unsigned char>(str.size());
+    repr_ = small;
+  } else {
+    auto buffer = std::make_shared<Buffer>();
+    buffer->reserve(str.size());
+    buffer->data.append(str);
+    repr_ = Shared{std::move(buffer), str.size()};
+  }
+}
+
+StrValue::StrValue(std::string&& str) {
+  if (str.size() <= INLINE_CAPACITY) {
+    *this = StrValue(std::string_view(str));
+  } else {
+    auto size = str.size();
+    repr_ = Shared{std::make_shared<Buffer>(std::move(str)), size};
+  }
+}
+
+std::string_view StrValue::view() const {
+  if (const auto* small = std::get_if<Inline>(&repr_)) {
+    return {small->data.data(), small->size};
+  }
+  const auto& shared = std::get<Shared>(repr_);
+  return {shared.buffer->data.data(), shared.size};
+}
+
+std::size_t StrValue::size() const {
+  if (const auto* small = std::get_if<Inline>(&repr_)) {
+    return small->size;
+  }
+  return std::get<Shared>(repr_).size;
+}
+
+StrValue operator+(const StrValue& lhs, const StrValue& rhs) {
+  const auto size = lhs.size() + rhs.size();
+  if (size <= StrValue::INLINE_CAPACITY) {
+    StrValue::Inline small{};
+    auto end =
+        std::copy(lhs.view().begin(), lhs.view().end(), small.data.begin());
+    std::copy(rhs.view().begin(), rhs.view().end(), end);
+    small.size = static_cast<unsigned char>(size);
+    StrValue result;
+    result.repr_ = small;
+    return result;
+  }
+
+  if (const auto* shared = std::get_if<StrValue::Shared>(&lhs.repr_)) {
+    // lhs views the whole buffer, so nobody else can observe bytes appended
+    // past its end
+    auto& data = shared->buffer->data;
+    if (shared->size == data.size()) {
+      const auto* rhs_shared = std::get_if<StrValue::Shared>(&rhs.repr_);
+      if (rhs_shared && rhs_shared->buffer == shared->buffer) {
+        // appending a view of the buffer to itself, copy it out first
+        std::string copy(rhs.view());
+        shared->buffer->reserve(size);
+        data.append(copy);
+      } else {
+        shared->buffer->reserve(size);
+        data.append(rhs.view());
+      }
+      return StrValue(StrValue::Shared{shared->buffer, size});
+    }
+  }
+
+  auto buffer = std::make_shared<StrValue::Buffer>();
+  buffer->reserve(size);
+  buffer->data.append(lhs.view());
+  buffer->data.append(rhs.view());
+  return StrValue(StrValue::Shared{std::move(buffer), size});
+}
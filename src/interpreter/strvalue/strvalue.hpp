@@ -0,0 +1,101 @@
+/*! @file strvalue.hpp
+    @brief boalang string value.
+*/
+
+#ifndef BOALANG_STRVALUE_HPP
+#define BOALANG_STRVALUE_HPP
+
+#include <array>
+#include <compare>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <variant>
+
+/**
+ * @brief Immutable string value used by the interpreter.
+ *
+ * Short strings are stored inline without heap allocation. Longer strings
+ * live in a buffer shared between copies, each copy viewing only its own
+ * prefix of that buffer. Concatenation onto a value that views the whole
+ * buffer appends in place, so chains like `s = s + x` take amortized linear
+ * time instead of copying the accumulated string on every step.
+ *
+ * Capacity of shared buffers is charged to the active MemoryTracker.
+ */
+class StrValue {
+ public:
+  static constexpr std::size_t INLINE_CAPACITY =
+      22; /**< Longest string stored without heap allocation. */
+
+ private:
+  /**
+   * @brief Small string stored directly in the value.
+   */
+  struct Inline {
+    std::array<char, INLINE_CAPACITY> data;
+    unsigned char size;
+  };
+
+  struct Buffer;
+
+  /**
+   * @brief Prefix of a buffer shared with other values.
+   */
+  struct Shared {
+    std::shared_ptr<Buffer> buffer;
+    std::size_t size;
+  };
+
+  std::variant<Inline, Shared> repr_;
+
+  explicit StrValue(Shared shared) : repr_(std::move(shared)){};
+
+ public:
+  /**
+   * @brief Constructs an empty string value.
+   */
+  StrValue() : repr_(Inline{}){};
+
+  /**
+   * @brief Constructs a string value by copying \p str.
+   */
+  explicit StrValue(std::string_view str);
+
+  /**
+   * @brief Constructs a string value taking ownership of \p str.
+   */
+  explicit StrValue(std::string&& str);
+
+  /**
+   * @brief Constructs a string value by copying \p str.
+   */
+  explicit StrValue(const char* str) : StrValue(std::string_view(str)){};
+
+  [[nodiscard]] std::string_view view() const;
+  [[nodiscard]] std::size_t size() const;
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Copies the value into a std::string.
+   */
+  [[nodiscard]] std::string str() const { return std::string(view()); }
+
+  friend StrValue operator+(const StrValue& lhs, const StrValue& rhs);
+
+  friend bool operator==(const StrValue& lhs, const StrValue& rhs) {
+    return lhs.view() == rhs.view();
+  }
+
+  friend std::strong_ordering operator<=>(const StrValue& lhs,
+                                          const StrValue& rhs) {
+    return lhs.view() <=> rhs.view();
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const StrValue& value) {
+    return os << value.view();
+  }
+};
+
+#endif  // BOALANG_STRVALUE_HPP
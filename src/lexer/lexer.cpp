@@ -1,15 +1,17 @@
 #include "lexer.hpp"
 
 #include <cmath>
-#include <functional>
 #include <initializer_list>
 #include <vector>
 
+#include "source/scan.hpp"
+
 static const std::initializer_list<std::pair<std::string, TokenType>> keywords{
     {"if", TOKEN_IF},           {"else", TOKEN_ELSE},
     {"and", TOKEN_AND},         {"or", TOKEN_OR},
     {"true", TOKEN_TRUE},       {"false", TOKEN_FALSE},
     {"while", TOKEN_WHILE},     {"return", TOKEN_RETURN},
+    {"for", TOKEN_FOR},         {"in", TOKEN_IN},
     {"is", TOKEN_IS},           {"as", TOKEN_AS},
     {"print", TOKEN_PRINT},     {"inspect", TOKEN_INSPECT},
     {"struct", TOKEN_STRUCT},   {"variant", TOKEN_VARIANT},
@@ -19,6 +21,12 @@ static const std::initializer_list<std::pair<std::string, TokenType>> keywords{
     {"default", TOKEN_DEFAULT},
 }; /**< List of all supported keywords. */
 
+const Lexer::TokenHandlers Lexer::token_handlers = {
+    &Lexer::handle_single_char_token, &Lexer::handle_double_char_token,
+    &Lexer::handle_slash_token,       &Lexer::try_tokenize_string,
+    &Lexer::try_tokenize_identifier,  &Lexer::try_tokenize_number,
+};
+
 static constexpr int BASE =
     10; /**< The base number of the decimal number system. */
 
@@ -40,9 +48,8 @@ opt_token_t Lexer::try_tokenize_string() {
     return std::nullopt;
   }
 
-  while (source_.peek() != '"' && !source_.eof() && source_.peek() != '\n') {
-    advance();
-  }
+  std::string_view rest = source_.remaining();
+  advance(scan_kernels().find_either(rest, '"', '\n'));
   if (source_.peek() != '"') {
     throw LexerError(build_token_with_value(TOKEN_UNKNOWN),
                      "Unterminated string");
@@ -69,6 +76,10 @@ opt_token_t Lexer::try_tokenize_number() {
 
   while (std::isdigit(source_.peek()) || source_.peek() == '.') {
     if (source_.peek() == '.') {
+      // "1..n" is a range, not a fraction
+      if (source_.remaining().substr(1, 1) == ".") {
+        break;
+      }
       return build_fraction(value);
     }
     int digit = advance() - '0';
@@ -144,22 +155,29 @@ opt_token_t Lexer::try_tokenize_comment() {
 
   if (source_.peek() == '/') {  // Single-line comment
     advance();
-    while (source_.current() != '\n' && !source_.eof()) {
-      advance();
-    }
+    std::string_view rest = source_.remaining();
+    std::size_t newline = scan_kernels().find_char(rest, '\n');
+    advance(newline < rest.size() ? newline + 1 : rest.size());
     return build_token_with_value(
         TOKEN_COMMENT,
         current_context_.substr(2, current_context_.length() - 3));
   }
   if (source_.peek() == '*') {  // Multi-line comment
     advance();
-    while (!source_.eof()) {
-      if (advance() == '*' && match('/')) {
+    std::string_view rest = source_.remaining();
+    for (std::size_t i = 0;; ++i) {
+      i += scan_kernels().find_char(rest.substr(i), '*');
+      if (i + 1 >= rest.size()) {
+        break;
+      }
+      if (rest[i + 1] == '/') {
+        advance(i + 2);
         return build_token_with_value(
             TOKEN_COMMENT,
             current_context_.substr(2, current_context_.length() - 4));
       }
     }
+    advance(rest.size());
     throw LexerError(build_token_with_value(TOKEN_UNKNOWN),
                      "Unterminated long comment");
   }
@@ -179,10 +197,12 @@ opt_token_t Lexer::handle_single_char_token() {
       return build_token(TOKEN_LBRACE);
     case '}':
       return build_token(TOKEN_RBRACE);
+    case '[':
+      return build_token(TOKEN_LBRACKET);
+    case ']':
+      return build_token(TOKEN_RBRACKET);
     case ',':
       return build_token(TOKEN_COMMA);
-    case '.':
-      return build_token(TOKEN_DOT);
     case '-':
       return build_token(TOKEN_MINUS);
     case '+':
@@ -211,6 +231,11 @@ opt_token_t Lexer::handle_double_char_token() {
         return build_token(TOKEN_ARROW);
       }
       return build_token(TOKEN_EQUAL);
+    case '.':  // '..'
+      if (match('.')) {
+        return build_token(TOKEN_DOT_DOT);
+      }
+      return build_token(TOKEN_DOT);
     case '<':  // '<='
       if (match('=')) {
         return build_token(TOKEN_LESS_EQUAL);
@@ -237,9 +262,7 @@ opt_token_t Lexer::handle_slash_token() {
 }
 
 void Lexer::skip_whitespace() {
-  while (std::isspace(source_.peek())) {
-    advance();
-  }
+  source_.skip(scan_kernels().find_non_whitespace(source_.remaining()));
 }
 
 Token Lexer::next_token() {
@@ -247,17 +270,8 @@ Token Lexer::next_token() {
   current_context_.clear();
   advance();
 
-  std::vector<std::function<opt_token_t()>> token_handlers = {
-      [this]() { return handle_single_char_token(); },
-      [this]() { return handle_double_char_token(); },
-      [this]() { return handle_slash_token(); },
-      [this]() { return try_tokenize_string(); },
-      [this]() { return try_tokenize_identifier(); },
-      [this]() { return try_tokenize_number(); },
-  };
-
-  for (auto& handler : token_handlers) {
-    if (opt_token_t t = handler()) {
+  for (const auto& handler : token_handlers) {
+    if (opt_token_t t = (this->*handler)()) {
       return *t;
     }
   }
@@ -272,6 +286,11 @@ char Lexer::advance() {
   return c;
 }
 
+void Lexer::advance(std::size_t count) {
+  current_context_.append(source_.remaining().substr(0, count));
+  source_.skip(count);
+}
+
 bool Lexer::match(char c) {
   if (c == source_.peek()) {
     advance();
@@ -280,6 +299,21 @@ bool Lexer::match(char c) {
   return false;
 }
 
+std::vector<Token> Lexer::tokenize() {
+  std::vector<Token> tokens;
+  while (true) {
+    Token token = next_token();
+    if (token.get_type() == TOKEN_COMMENT) {
+      continue;
+    }
+    bool etx = token.get_type() == TOKEN_ETX;
+    tokens.push_back(std::move(token));
+    if (etx) {
+      return tokens;
+    }
+  }
+}
+
 Token LexerCommentFilter::next_token() {
   while (true) {
     Token token = lexer_.next_token();
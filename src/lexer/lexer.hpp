@@ -5,7 +5,9 @@
 #ifndef BOALANG_LEXER_HPP
 #define BOALANG_LEXER_HPP
 
+#include <initializer_list>
 #include <optional>
+#include <vector>
 
 #include "source/source.hpp"
 #include "token/token.hpp"
@@ -38,6 +40,10 @@ class Lexer : public ILexer {
   std::string current_context_; /**< Stores advanced chars. */
   Source& source_; /**< Reference to the Source object for tokenization. */
 
+  using TokenHandlers = std::initializer_list<opt_token_t (Lexer::*)()>;
+  static const TokenHandlers
+      token_handlers; /**< Handlers tried in order for each token. */
+
   /**
    * @brief Builds a token of the specified type with \ref
    * Lexer.current_context_ as value.
@@ -70,6 +76,13 @@ class Lexer : public ILexer {
    */
   char advance();
 
+  /**
+   * @brief Retrieves \p count next characters from \ref Lexer.source_ at
+   * once.
+   * @param count Number of characters to retrieve.
+   */
+  void advance(std::size_t count);
+
   /**
    * @brief Checks if peeked character matches \p c.
    *
@@ -103,6 +116,12 @@ class Lexer : public ILexer {
    * @return The next token.
    */
   Token next_token() override;
+
+  /**
+   * @brief Tokenizes whole source in one pass, dropping comments.
+   * @return All tokens, terminated with TOKEN_ETX.
+   */
+  std::vector<Token> tokenize();
 };
 
 /**
@@ -0,0 +1,102 @@
+#include "parallel_lexer.hpp"
+
+#include <exception>
+#include <future>
+#include <optional>
+#include <string_view>
+
+#include "lexer/lexer.hpp"
+#include "source/scan.hpp"
+
+/**
+ * @brief Lexes \p text starting at a line beginning preceded by \p lines
+ * lines.
+ */
+static std::vector<Token> tokenize_lines(std::string_view text,
+                                         unsigned int lines) {
+  StringSource source(std::string(text), Position{lines + 1, 0});
+  return Lexer(source).tokenize();
+}
+
+std::vector<std::size_t> ParallelLexer::split(std::size_t chunks) const {
+  std::string_view text = source_.remaining();
+  std::size_t chunk_size =
+      std::max(text.size() / chunks + 1, MIN_PARALLEL_CHUNK_SIZE);
+  const ScanKernels& scan = scan_kernels();
+
+  std::vector<std::size_t> starts{0};
+  std::size_t from = chunk_size;
+  while (from < text.size()) {
+    std::size_t start = from + scan.find_char(text.substr(from), '\n') + 1;
+    if (start >= text.size()) {
+      break;
+    }
+    // speculatively skip past a comment opened in the current chunk
+    std::string_view chunk = text.substr(starts.back(), start - starts.back());
+    std::size_t open = chunk.rfind("/*");
+    std::size_t close = chunk.rfind("*/");
+    if (open != std::string_view::npos &&
+        (close == std::string_view::npos || close < open)) {
+      from = text.find("*/", start);
+      if (from == std::string_view::npos) {
+        break;
+      }
+      continue;
+    }
+    starts.push_back(start);
+    from = start + chunk_size;
+  }
+  return starts;
+}
+
+std::vector<Token> ParallelLexer::tokenize() {
+  std::string_view text = source_.remaining();
+  std::vector<std::size_t> starts = split(pool_.size());
+  starts.push_back(text.size());
+
+  std::vector<unsigned int> lines{0};
+  for (std::size_t i = 1; i + 1 < starts.size(); ++i) {
+    auto chunk = text.substr(starts[i - 1], starts[i] - starts[i - 1]);
+    lines.push_back(lines.back() + static_cast<unsigned int>(
+                                       scan_kernels().count_char(chunk, '\n')));
+  }
+
+  std::vector<std::future<std::optional<std::vector<Token>>>> results;
+  for (std::size_t i = 0; i + 1 < starts.size(); ++i) {
+    auto chunk = text.substr(starts[i], starts[i + 1] - starts[i]);
+    results.push_back(pool_.submit(
+        [chunk, line = lines[i]]() -> std::optional<std::vector<Token>> {
+          try {
+            return tokenize_lines(chunk, line);
+          } catch (const std::exception&) {
+            return std::nullopt;
+          }
+        }));
+  }
+
+  std::vector<std::optional<std::vector<Token>>> chunks;
+  std::size_t total = 0;
+  for (auto& result : results) {
+    chunks.push_back(result.get());
+    total += chunks.back() ? chunks.back()->size() : 0;
+  }
+
+  std::vector<Token> tokens;
+  tokens.reserve(total);
+  for (std::size_t i = 0; i < chunks.size(); ++i) {
+    auto& chunk_tokens = chunks[i];
+    if (!chunk_tokens) {
+      // restart point was not a token boundary or source is malformed
+      auto rest = tokenize_lines(text.substr(starts[i]), lines[i]);
+      tokens.insert(tokens.end(), std::make_move_iterator(rest.begin()),
+                    std::make_move_iterator(rest.end()));
+      return tokens;
+    }
+    if (i + 1 < chunks.size()) {
+      chunk_tokens->pop_back();  // TOKEN_ETX
+    }
+    tokens.insert(tokens.end(), std::make_move_iterator(chunk_tokens->begin()),
+                  std::make_move_iterator(chunk_tokens->end()));
+  }
+  return tokens;
+}
@@ -0,0 +1,52 @@
+/*! @file parallel_lexer.hpp
+    @brief Multithreaded lexing of large sources.
+*/
+
+#ifndef BOALANG_PARALLEL_LEXER_HPP
+#define BOALANG_PARALLEL_LEXER_HPP
+
+#include <string>
+#include <vector>
+
+#include "source/source.hpp"
+#include "token/token.hpp"
+#include "utils/thread_pool.hpp"
+
+constexpr std::size_t MIN_PARALLEL_CHUNK_SIZE =
+    1 << 16; /**< Sources are not split into chunks smaller than this. */
+
+/**
+ * @brief Lexer splitting source into chunks lexed on a thread pool.
+ *
+ * Chunks start at line beginnings, which are token boundaries unless they are
+ * inside a multi-line comment (string literals cannot span lines). Restart
+ * points are picked by a speculative pre-scan avoiding apparent comments and
+ * validated after lexing: a chunk that lexed without errors ends at a token
+ * boundary, so the next chunk started at one too. Lexing is redone
+ * sequentially from the first chunk that failed, which also reports genuine
+ * errors exactly as Lexer would.
+ *
+ * Produces the same tokens as Lexer::tokenize().
+ */
+class ParallelLexer {
+  Source source_;    /**< Normalized source text. */
+  ThreadPool& pool_; /**< Pool lexing the chunks. */
+
+  /**
+   * @brief Finds restart points for at most \p chunks chunks.
+   * @return Chunk start offsets, beginning with 0.
+   */
+  [[nodiscard]] std::vector<std::size_t> split(std::size_t chunks) const;
+
+ public:
+  ParallelLexer(const std::string& source, ThreadPool& pool)
+      : source_(source), pool_(pool){};
+
+  /**
+   * @brief Tokenizes whole source, dropping comments.
+   * @return All tokens, terminated with TOKEN_ETX.
+   */
+  std::vector<Token> tokenize();
+};
+
+#endif  // BOALANG_PARALLEL_LEXER_HPP
@@ -1,16 +1,31 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <future>
 #include <iostream>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "argparse/argparse.hpp"
 #include "ast/astprinter.hpp"
 #include "interpreter/interpreter.hpp"
 #include "lexer/lexer.hpp"
+#include "lexer/parallel_lexer.hpp"
+#include "optimizer/optimizer.hpp"
+#include "parser/parallel_parser.hpp"
 #include "parser/parser.hpp"
+#include "serializer/cache.hpp"
 #include "source/source.hpp"
 
 void parse_args(int& argc, char* argv[], argparse::ArgumentParser& program) {
-  program.add_argument("source");
+  program.add_argument("source")
+      .help("source files, or programs with --cmd")
+      .nargs(argparse::nargs_pattern::at_least_one);
   program.add_argument("-c", "--cmd")
       .help("program passed in as string")
       .default_value(false)
@@ -18,6 +33,49 @@ void parse_args(int& argc, char* argv[], argparse::ArgumentParser& program) {
   program.add_argument("--ast")
       .help("print AST instead of interpreting")
       .flag();
+  program.add_argument("--no-cache")
+      .help("do not read or write cached program next to the source file")
+      .flag();
+  program.add_argument("--lex-jobs")
+      .help("number of threads lexing the source")
+      .default_value(std::size_t{1})
+      .scan<'u', std::size_t>();
+  program.add_argument("--parse-jobs")
+      .help("number of threads parsing top-level statements")
+      .default_value(std::size_t{1})
+      .scan<'u', std::size_t>();
+  program.add_argument("--jobs")
+      .help(
+          "number of threads running multiple sources, each printing "
+          "after it finishes")
+      .default_value(std::size_t{1})
+      .scan<'u', std::size_t>();
+  program.add_argument("--max-memory")
+      .help(
+          "maximum bytes held by values of a program, exceeding it is a "
+          "runtime error")
+      .scan<'u', std::size_t>();
+  program.add_argument("--max-steps")
+      .help("maximum loop iterations and function calls of a program")
+      .scan<'u', std::uint64_t>();
+  program.add_argument("--timeout")
+      .help("maximum milliseconds a program may run")
+      .scan<'u', std::uint64_t>();
+  program.add_argument("--memoize")
+      .help("cache results of functions without side effects by arguments")
+      .flag();
+  program.add_argument("--memo-size")
+      .help("maximum results cached per function with --memoize")
+      .default_value(DEFAULT_MEMO_CAPACITY)
+      .scan<'u', std::size_t>();
+  program.add_argument("--no-optimize")
+      .help("run programs as parsed, without inlining small functions")
+      .flag();
+  program.add_argument("--stats")
+      .help(
+          "print statistics of optimizations and memoized functions to "
+          "stderr")
+      .flag();
 
   try {
     program.parse_args(argc, argv);
@@ -28,25 +86,199 @@ void parse_args(int& argc, char* argv[], argparse::ArgumentParser& program) {
   }
 }
 
+struct ParseJobs {
+  std::size_t lex;
+  std::size_t parse;
+};
+
+std::unique_ptr<Program> parse(const std::string& code, ParseJobs jobs) {
+  std::vector<Token> tokens;
+  if (jobs.lex > 1) {
+    ThreadPool pool(jobs.lex);
+    tokens = ParallelLexer(code, pool).tokenize();
+  } else {
+    StringSource source(code);
+    tokens = Lexer(source).tokenize();
+  }
+
+  if (jobs.parse > 1) {
+    ThreadPool pool(jobs.parse);
+    return ParallelParser(std::move(tokens), pool).parse();
+  }
+  return Parser(std::move(tokens)).parse();
+}
+
+std::unique_ptr<Program> load_program(const std::string& path, bool use_cache,
+                                      ParseJobs jobs) {
+  std::ifstream file(path, std::ios::binary);
+  std::string content{std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>()};
+  if (!use_cache || !file) {
+    return parse(content, jobs);
+  }
+  std::uint64_t hash = hash_source(content);
+  std::string cached = cache_path(path);
+
+  if (auto program = load_cached_program(cached, hash)) {
+    return program;
+  }
+  auto program = parse(content, jobs);
+  store_cached_program(cached, *program, hash);
+  return program;
+}
+
+/**
+ * @brief Where programs come from and how they are parsed.
+ */
+struct LoadOptions {
+  bool cmd;       /**< Sources are programs, not paths. */
+  bool use_cache; /**< Read and write cached programs next to source files. */
+  ParseJobs jobs;
+};
+
+std::unique_ptr<Program> load(const std::string& source,
+                              const LoadOptions& options) {
+  if (options.cmd) {
+    return parse(source, options.jobs);
+  }
+  return load_program(source, options.use_cache, options.jobs);
+}
+
+/**
+ * @brief Limits and optimizations applied to interpreted programs.
+ */
+struct RunOptions {
+  std::optional<std::size_t> max_memory;
+  ExecutionLimits limits;
+  std::optional<std::size_t> memo_capacity;
+  bool optimize = true;
+  bool stats = false; /**< Print statistics of optimizations and memoized
+                         functions. */
+};
+
+void configure(Interpreter& interpreter, const RunOptions& options) {
+  if (options.max_memory) {
+    interpreter.memory().set_limit(*options.max_memory);
+  }
+  interpreter.limits() = options.limits;
+  interpreter.memo_capacity() = options.memo_capacity;
+}
+
+void print_stats(const OptimizerStats& optimized,
+                 const Interpreter& interpreter, std::ostream& out) {
+  out << "inlined calls: " << optimized.inlined_calls << "\n";
+  out << "local initializer lists: " << optimized.local_lists << "\n";
+  out << "unreachable statements: " << optimized.unreachable_statements << "\n";
+  out << "unused declarations: " << optimized.unused_declarations << "\n";
+  for (const auto& [name, stats] : interpreter.memo_stats()) {
+    out << "memo " << name << ": " << stats.hits << " hits, " << stats.misses
+        << " misses, " << stats.evictions << " evictions, " << stats.entries
+        << " entries, hit rate " << stats.hit_rate() * 100 << "%\n";
+  }
+}
+
+/**
+ * @brief Optimizes \p program unless disabled and runs it, printing
+ * requested statistics to \p stats.
+ */
+void run(Interpreter& interpreter, Program& program, const RunOptions& options,
+         std::ostream& stats) {
+  configure(interpreter, options);
+  OptimizerStats optimized;
+  if (options.optimize) {
+    optimized = optimize(program);
+  }
+  interpreter.visit(program);
+  if (options.stats) {
+    print_stats(optimized, interpreter, stats);
+  }
+}
+
+/**
+ * @brief Output of a program run in batch.
+ */
+struct RunResult {
+  std::string output;
+  std::optional<std::string> error;
+  std::string stats; /**< Printed to stderr when requested. */
+};
+
+RunResult run_captured(const std::string& source, const LoadOptions& options,
+                       const RunOptions& run_options) {
+  std::ostringstream out;
+  std::ostringstream stats;
+  try {
+    Interpreter interpreter(out);
+    run(interpreter, *load(source, options), run_options, stats);
+  } catch (const std::runtime_error& error) {
+    return {out.str(), error.what(), stats.str()};
+  }
+  return {out.str(), std::nullopt, stats.str()};
+}
+
+/**
+ * @brief Runs \p sources on \p threads threads, each with its own
+ * interpreter, and prints their outputs in order.
+ *
+ * @return Whether all programs succeeded.
+ */
+bool run_batch(const std::vector<std::string>& sources, std::size_t threads,
+               const LoadOptions& options, const RunOptions& run_options) {
+  ThreadPool pool(std::max<std::size_t>(threads, 1));
+  std::vector<std::future<RunResult>> results;
+  results.reserve(sources.size());
+  for (const auto& source : sources) {
+    results.push_back(pool.submit([&source, &options, &run_options] {
+      return run_captured(source, options, run_options);
+    }));
+  }
+
+  bool success = true;
+  for (auto& future : results) {
+    RunResult result = future.get();
+    std::cout << result.output << std::flush;
+    std::cerr << result.stats;
+    if (result.error) {
+      std::cerr << "[[[Error occurred: " << *result.error << "]]]\n";
+      success = false;
+    }
+  }
+  return success;
+}
+
 int main(int argc, char* argv[]) {
   try {
     argparse::ArgumentParser program("boalang");
     parse_args(argc, argv, program);
 
-    std::unique_ptr<Source> src;
-    if (program.is_used("--cmd")) {
-      src = std::make_unique<StringSource>(program.get<std::string>("source"));
-    } else {
-      src = std::make_unique<FileSource>(program.get<std::string>("source"));
+    LoadOptions options{program.is_used("--cmd"),
+                        !program.get<bool>("--no-cache"),
+                        {program.get<std::size_t>("--lex-jobs"),
+                         program.get<std::size_t>("--parse-jobs")}};
+    RunOptions run_options;
+    run_options.max_memory = program.present<std::size_t>("--max-memory");
+    run_options.limits.max_steps =
+        program.present<std::uint64_t>("--max-steps");
+    if (auto timeout = program.present<std::uint64_t>("--timeout")) {
+      run_options.limits.timeout = std::chrono::milliseconds(*timeout);
+    }
+    if (program.get<bool>("--memoize")) {
+      run_options.memo_capacity = program.get<std::size_t>("--memo-size");
     }
+    run_options.optimize = !program.get<bool>("--no-optimize");
+    run_options.stats = program.get<bool>("--stats");
+    auto sources = program.get<std::vector<std::string>>("source");
 
-    Lexer lexer(*src);
-    LexerCommentFilter filter(lexer);
-    Parser parser(filter);
     if (program.is_used("--ast")) {
-      ASTPrinter().print(parser.parse().get());
-    } else {
-      Interpreter().visit(*parser.parse());
+      for (const auto& source : sources) {
+        ASTPrinter().print(load(source, options).get());
+      }
+    } else if (sources.size() == 1 && !program.is_used("--jobs")) {
+      Interpreter interpreter;
+      run(interpreter, *load(sources.front(), options), run_options, std::cerr);
+    } else if (!run_batch(sources, program.get<std::size_t>("--jobs"), options,
+                          run_options)) {
+      return 1;
     }
   } catch (const std::runtime_error& error) {
     std::cerr << "[[[Error occurred: " << error.what() << "]]]\n";
@@ -0,0 +1,249 @@
+#include "dead_code.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ast/astwalker.hpp"
+
+namespace {
+
+/**
+ * @return Whether running \p stmt always ends with a return, so that blocks
+ * skip statements following it.
+ */
+bool always_returns(const Stmt* stmt) {
+  if (dynamic_cast<const ReturnStmt*>(stmt)) {
+    return true;
+  }
+  if (const auto* block = dynamic_cast<const BlockStmt*>(stmt)) {
+    return std::ranges::any_of(block->statements, [](const auto& item) {
+      return always_returns(item.get());
+    });
+  }
+  if (const auto* if_stmt = dynamic_cast<const IfStmt*>(stmt)) {
+    return always_returns(if_stmt->then_branch.get()) &&
+           always_returns(if_stmt->else_branch.get());
+  }
+  return false;
+}
+
+class UnreachableRemover : public MutableASTWalker {
+  std::size_t removed_ = 0;
+
+ public:
+  std::size_t run(Program& program) {
+    for (const auto& stmt : program.statements) {
+      walk(stmt.get());
+    }
+    return removed_;
+  }
+
+  void visit(BlockStmt& stmt) override {
+    auto& statements = stmt.statements;
+    auto last = std::ranges::find_if(statements, [](const auto& item) {
+      return always_returns(item.get());
+    });
+    if (last != statements.end() && ++last != statements.end()) {
+      removed_ += static_cast<std::size_t>(statements.end() - last);
+      statements.erase(last, statements.end());
+    }
+    MutableASTWalker::visit(stmt);
+  }
+};
+
+/**
+ * @brief Collects names of functions called and types named by walked
+ * statements, and of those they define, which fail when already defined
+ * in the outermost scope.
+ */
+class UseFinder : public ASTWalker {
+  void use(const VarType& type) {
+    if (!type.name.empty()) {
+      types.push_back(type.name);
+    }
+    if (type.element) {
+      use(*type.element);
+    }
+    if (type.key) {
+      use(*type.key);
+    }
+  }
+
+ public:
+  std::vector<std::string> functions; /**< Not yet handled by the caller. */
+  std::vector<std::string> types;     /**< Not yet handled by the caller. */
+
+  void visit(const VarDeclStmt& stmt) override {
+    use(stmt.type);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const ForStmt& stmt) override {
+    use(stmt.type);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const StructFieldStmt& stmt) override { use(stmt.type); }
+
+  void visit(const StructDeclStmt& stmt) override {
+    types.push_back(stmt.identifier);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const VariantDeclStmt& stmt) override {
+    types.push_back(stmt.identifier);
+    for (const auto& param : stmt.params) {
+      use(param);
+    }
+  }
+
+  void visit(const FuncParamStmt& stmt) override { use(stmt.type); }
+
+  void visit(const FuncStmt& stmt) override {
+    functions.push_back(stmt.identifier);
+    use(stmt.return_type);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const LambdaFuncStmt& stmt) override {
+    use(stmt.type);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const IsTypeExpr& expr) override {
+    use(expr.type);
+    ASTWalker::visit(expr);
+  }
+
+  void visit(const AsTypeExpr& expr) override {
+    use(expr.type);
+    ASTWalker::visit(expr);
+  }
+
+  void visit(const CallStmt& stmt) override {
+    functions.push_back(stmt.identifier);
+    ASTWalker::visit(stmt);
+  }
+
+  void visit(const CallExpr& expr) override {
+    if (!expr.inlined) {
+      functions.push_back(expr.identifier);
+    }
+    ASTWalker::visit(expr);
+  }
+};
+
+/**
+ * @brief Declaration in the outermost scope.
+ */
+struct Declaration {
+  const Stmt* stmt;  /**< Null when the name is defined more than once. */
+  std::size_t index; /**< Position of the first definition. */
+};
+
+class DeclarationRemover {
+  std::unordered_map<std::string, Declaration> functions_;
+  std::unordered_map<std::string, Declaration> types_;
+  std::unordered_set<const Stmt*> used_;
+  UseFinder uses_;
+
+  static void declare(std::unordered_map<std::string, Declaration>& names,
+                      const std::string& name, const Stmt* stmt,
+                      std::size_t index) {
+    auto [found, inserted] = names.try_emplace(name, Declaration{stmt, index});
+    if (!inserted) {
+      found->second.stmt = nullptr;
+    }
+  }
+
+  /**
+   * @return Whether \p stmt may be removed without changing errors of the
+   * program.
+   */
+  [[nodiscard]] bool removable(const Stmt* stmt, std::size_t index) const {
+    if (const auto* func = dynamic_cast<const FuncStmt*>(stmt)) {
+      const auto& params = func->params;
+      for (auto param = params.begin(); param != params.end(); ++param) {
+        if (std::any_of(params.begin(), param, [&](const auto& other) {
+              return other->identifier == (*param)->identifier;
+            })) {
+          return false;
+        }
+      }
+      return functions_.at(func->identifier).stmt == func;
+    }
+    if (const auto* decl = dynamic_cast<const StructDeclStmt*>(stmt)) {
+      return types_.at(decl->identifier).stmt == decl;
+    }
+    if (const auto* decl = dynamic_cast<const VariantDeclStmt*>(stmt)) {
+      return types_.at(decl->identifier).stmt == decl &&
+             std::ranges::all_of(decl->params, [&](const auto& param) {
+               auto found = types_.find(param.name);
+               return param.name.empty() ||
+                      (found != types_.end() && found->second.index < index);
+             });
+    }
+    return false;
+  }
+
+  void use(const std::unordered_map<std::string, Declaration>& names,
+           const std::string& name) {
+    auto found = names.find(name);
+    if (found != names.end() && found->second.stmt &&
+        used_.insert(found->second.stmt).second) {
+      found->second.stmt->accept(uses_);
+    }
+  }
+
+ public:
+  std::size_t run(Program& program) {
+    const auto& statements = program.statements;
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+      const Stmt* stmt = statements[i].get();
+      if (const auto* func = dynamic_cast<const FuncStmt*>(stmt)) {
+        declare(functions_, func->identifier, func, i);
+      } else if (const auto* decl = dynamic_cast<const StructDeclStmt*>(stmt)) {
+        declare(types_, decl->identifier, decl, i);
+      } else if (const auto* decl =
+                     dynamic_cast<const VariantDeclStmt*>(stmt)) {
+        declare(types_, decl->identifier, decl, i);
+      }
+    }
+
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+      const Stmt* stmt = statements[i].get();
+      if (!removable(stmt, i)) {
+        used_.insert(stmt);
+        stmt->accept(uses_);
+      }
+    }
+    while (!uses_.functions.empty() || !uses_.types.empty()) {
+      if (!uses_.functions.empty()) {
+        auto name = std::move(uses_.functions.back());
+        uses_.functions.pop_back();
+        use(functions_, name);
+      } else {
+        auto name = std::move(uses_.types.back());
+        uses_.types.pop_back();
+        use(types_, name);
+      }
+    }
+
+    return std::erase_if(program.statements, [&](const auto& stmt) {
+      return !used_.contains(stmt.get());
+    });
+  }
+};
+
+}  // namespace
+
+std::size_t remove_unreachable_statements(Program& program) {
+  return UnreachableRemover().run(program);
+}
+
+std::size_t remove_unused_declarations(Program& program) {
+  return DeclarationRemover().run(program);
+}
@@ -0,0 +1,36 @@
+/*! @file dead_code.hpp
+    @brief Removal of code which never runs.
+*/
+
+#ifndef BOALANG_DEAD_CODE_HPP
+#define BOALANG_DEAD_CODE_HPP
+
+#include <cstddef>
+
+#include "stmt/stmt.hpp"
+
+/**
+ * @brief Removes statements of blocks following a statement which always
+ * returns: a return, a block ending with one, or an if statement returning
+ * from both branches.
+ *
+ * @return Number of removed statements.
+ */
+std::size_t remove_unreachable_statements(Program& program);
+
+/**
+ * @brief Removes functions, structs and variants defined in the outermost
+ * scope of \p program and never used by the rest of it.
+ *
+ * Declarations are used when they are called or name a type in statements
+ * run by the program, directly or through other used declarations. Calls
+ * evaluated in place of the function (see inline_calls()) do not use it.
+ * Declarations whose definition fails or depends on other ones with the
+ * same name, i.e. redefinitions, functions with repeated parameter names
+ * and variants of types not defined before, are kept to report the error.
+ *
+ * @return Number of removed declarations.
+ */
+std::size_t remove_unused_declarations(Program& program);
+
+#endif  // BOALANG_DEAD_CODE_HPP
@@ -0,0 +1,45 @@
+#include "escape.hpp"
+
+#include "ast/astwalker.hpp"
+
+namespace {
+
+class LocalListFinder : public MutableASTWalker {
+  std::size_t found_ = 0;
+
+  void mark(Expr* expr) {
+    auto* list = dynamic_cast<InitalizerListExpr*>(expr);
+    if (!list) {
+      return;
+    }
+    list->local = true;
+    ++found_;
+    for (const auto& item : list->list) {
+      mark(item.get());
+    }
+  }
+
+ public:
+  std::size_t run(Program& program) {
+    for (const auto& stmt : program.statements) {
+      walk(stmt.get());
+    }
+    return found_;
+  }
+
+  void visit(VarDeclStmt& stmt) override {
+    mark(stmt.initializer.get());
+    MutableASTWalker::visit(stmt);
+  }
+
+  void visit(AssignStmt& stmt) override {
+    mark(stmt.value.get());
+    MutableASTWalker::visit(stmt);
+  }
+};
+
+}  // namespace
+
+std::size_t find_local_lists(Program& program) {
+  return LocalListFinder().run(program);
+}
@@ -0,0 +1,26 @@
+/*! @file escape.hpp
+    @brief Escape analysis of initializer lists.
+*/
+
+#ifndef BOALANG_ESCAPE_HPP
+#define BOALANG_ESCAPE_HPP
+
+#include <cstddef>
+
+#include "stmt/stmt.hpp"
+
+/**
+ * @brief Sets \ref InitalizerListExpr.local of lists which do not escape
+ * the statement evaluating them.
+ *
+ * Such lists initialize a declared variable or are assigned, directly or as
+ * items of such lists. Their values are copied into the built struct, array
+ * or map, so the interpreter may evaluate them into reused storage. Lists
+ * passed to functions or returned from them may be kept by native
+ * functions, so they are allocated as before.
+ *
+ * @return Number of local lists.
+ */
+std::size_t find_local_lists(Program& program);
+
+#endif  // BOALANG_ESCAPE_HPP
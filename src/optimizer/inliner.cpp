@@ -0,0 +1,451 @@
+#include "inliner.hpp"
+
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ast/astwalker.hpp"
+#include "utils/overloaded.tpp"
+
+namespace {
+
+using var_types_t =
+    std::vector<std::map<std::string, BuiltinType>>; /**< Types of variables
+                                                        by nested scopes. */
+
+using args_t =
+    std::map<std::string, const Expr*>; /**< Arguments by parameters. */
+
+bool is_value_type(BuiltinType type) {
+  return type == INT || type == FLOAT || type == STR || type == BOOL;
+}
+
+/**
+ * @brief Finds type of value of an expression built of literals, variables
+ * of known types and operators. Other expressions have no known type.
+ */
+class TypeFinder : public ASTWalker {
+  const var_types_t& vars_;
+  std::optional<BuiltinType> type_;
+  bool unknown_ = false;
+
+  template <typename T>
+  std::optional<BuiltinType> operands(const T& expr) {
+    auto left = TypeFinder(vars_).find(*expr.left);
+    auto right = TypeFinder(vars_).find(*expr.right);
+    return left == right ? left : std::nullopt;
+  }
+
+  template <typename T>
+  void arithmetic(const T& expr) {
+    if (auto type = operands(expr); type == INT || type == FLOAT) {
+      type_ = type;
+    }
+  }
+
+  template <typename T>
+  void comparison(const T& expr) {
+    if (operands(expr)) {
+      type_ = BOOL;
+    }
+  }
+
+ protected:
+  void enter(const Expr&) override { unknown_ = true; }
+
+ public:
+  explicit TypeFinder(const var_types_t& vars) : vars_(vars) {}
+
+  std::optional<BuiltinType> find(const Expr& expr) {
+    walk(&expr);
+    return unknown_ ? std::nullopt : type_;
+  }
+
+  void visit(const LiteralExpr& expr) override {
+    type_ = std::visit(
+        overloaded{
+            [](std::monostate) -> std::optional<BuiltinType> {
+              return std::nullopt;
+            },
+            [](const std::string&) -> std::optional<BuiltinType> {
+              return STR;
+            },
+            [](int) -> std::optional<BuiltinType> { return INT; },
+            [](float) -> std::optional<BuiltinType> { return FLOAT; },
+            [](bool) -> std::optional<BuiltinType> { return BOOL; },
+        },
+        expr.literal);
+  }
+
+  void visit(const VarExpr& expr) override {
+    for (const auto& scope : vars_) {
+      if (auto found = scope.find(expr.identifier); found != scope.end()) {
+        type_ = found->second;
+      }
+    }
+  }
+
+  void visit(const GroupingExpr& expr) override {
+    type_ = TypeFinder(vars_).find(*expr.expr);
+  }
+
+  void visit(const AdditionExpr& expr) override {
+    if (auto type = operands(expr);
+        type == INT || type == FLOAT || type == STR) {
+      type_ = type;
+    }
+  }
+  void visit(const SubtractionExpr& expr) override { arithmetic(expr); }
+  void visit(const DivisionExpr& expr) override { arithmetic(expr); }
+  void visit(const MultiplicationExpr& expr) override { arithmetic(expr); }
+  void visit(const EqualCompExpr& expr) override { comparison(expr); }
+  void visit(const NotEqualCompExpr& expr) override { comparison(expr); }
+  void visit(const GreaterCompExpr& expr) override { comparison(expr); }
+  void visit(const GreaterEqualCompExpr& expr) override { comparison(expr); }
+  void visit(const LessCompExpr& expr) override { comparison(expr); }
+  void visit(const LessEqualCompExpr& expr) override { comparison(expr); }
+
+  // operands of any type are converted to bool
+  void visit(const LogicalOrExpr& expr) override {
+    if (TypeFinder(vars_).find(*expr.left) &&
+        TypeFinder(vars_).find(*expr.right)) {
+      type_ = BOOL;
+    }
+  }
+  void visit(const LogicalAndExpr& expr) override {
+    if (TypeFinder(vars_).find(*expr.left) &&
+        TypeFinder(vars_).find(*expr.right)) {
+      type_ = BOOL;
+    }
+  }
+  void visit(const LogicalNegationExpr& expr) override {
+    if (TypeFinder(vars_).find(*expr.right)) {
+      type_ = BOOL;
+    }
+  }
+};
+
+std::optional<BuiltinType> type_of(const Expr& expr, const var_types_t& vars) {
+  return TypeFinder(vars).find(expr);
+}
+
+/**
+ * @brief Copies expression accepted by TypeFinder, replacing variables
+ * named after parameters with copies of arguments.
+ */
+class Substituter : public ASTWalker {
+  const args_t& args_;
+  std::unique_ptr<Expr> result_;
+
+  template <typename T>
+  void binary(const T& expr) {
+    auto left = copy(*expr.left);
+    auto right = copy(*expr.right);
+    result_ =
+        std::make_unique<T>(std::move(left), std::move(right), expr.position);
+  }
+
+ public:
+  explicit Substituter(const args_t& args) : args_(args) {}
+
+  std::unique_ptr<Expr> copy(const Expr& expr) {
+    walk(&expr);
+    return std::move(result_);
+  }
+
+  void visit(const LiteralExpr& expr) override {
+    result_ = std::make_unique<LiteralExpr>(expr.literal, expr.position);
+  }
+
+  void visit(const VarExpr& expr) override {
+    if (auto arg = args_.find(expr.identifier); arg != args_.end()) {
+      // arguments name variables of the caller, never parameters
+      result_ = Substituter({}).copy(*arg->second);
+    } else {
+      result_ = std::make_unique<VarExpr>(expr.identifier, expr.position);
+    }
+  }
+
+  void visit(const GroupingExpr& expr) override {
+    auto inner = copy(*expr.expr);
+    result_ = std::make_unique<GroupingExpr>(std::move(inner), expr.position);
+  }
+
+  void visit(const LogicalNegationExpr& expr) override {
+    auto right = copy(*expr.right);
+    result_ =
+        std::make_unique<LogicalNegationExpr>(std::move(right), expr.position);
+  }
+
+  void visit(const AdditionExpr& expr) override { binary(expr); }
+  void visit(const SubtractionExpr& expr) override { binary(expr); }
+  void visit(const DivisionExpr& expr) override { binary(expr); }
+  void visit(const MultiplicationExpr& expr) override { binary(expr); }
+  void visit(const EqualCompExpr& expr) override { binary(expr); }
+  void visit(const NotEqualCompExpr& expr) override { binary(expr); }
+  void visit(const GreaterCompExpr& expr) override { binary(expr); }
+  void visit(const GreaterEqualCompExpr& expr) override { binary(expr); }
+  void visit(const LessCompExpr& expr) override { binary(expr); }
+  void visit(const LessEqualCompExpr& expr) override { binary(expr); }
+  void visit(const LogicalOrExpr& expr) override { binary(expr); }
+  void visit(const LogicalAndExpr& expr) override { binary(expr); }
+};
+
+/**
+ * @brief Counts expressions and uses of each variable.
+ */
+class UseCounter : public ASTWalker {
+ protected:
+  void enter(const Expr&) override { ++size; }
+
+ public:
+  std::size_t size = 0;
+  std::map<std::string, std::size_t> uses;
+
+  void visit(const VarExpr& expr) override {
+    ++size;
+    ++uses[expr.identifier];
+  }
+};
+
+/**
+ * @brief Follows expression accepted by TypeFinder in the order it is
+ * evaluated, noting when each variable is read for the first time.
+ */
+class EvaluationOrder : public ASTWalker {
+  std::size_t failing_ = 0;
+
+  template <typename T>
+  void arithmetic(const T& expr) {
+    ASTWalker::visit(expr);
+    ++failing_;
+  }
+
+ public:
+  struct FirstRead {
+    std::size_t order;          /**< Among first reads of all variables. */
+    std::size_t failing_before; /**< Operations which may fail evaluated
+                                   before the read. */
+  };
+  std::map<std::string, FirstRead> first_reads;
+
+  void visit(const VarExpr& expr) override {
+    if (!first_reads.contains(expr.identifier)) {
+      first_reads.emplace(expr.identifier,
+                          FirstRead{first_reads.size(), failing_});
+    }
+  }
+
+  // logical operators evaluate right operand first
+  void visit(const LogicalOrExpr& expr) override {
+    walk(expr.right.get());
+    walk(expr.left.get());
+  }
+  void visit(const LogicalAndExpr& expr) override {
+    walk(expr.right.get());
+    walk(expr.left.get());
+  }
+
+  void visit(const AdditionExpr& expr) override { arithmetic(expr); }
+  void visit(const SubtractionExpr& expr) override { arithmetic(expr); }
+  void visit(const DivisionExpr& expr) override { arithmetic(expr); }
+  void visit(const MultiplicationExpr& expr) override { arithmetic(expr); }
+};
+
+/**
+ * @brief Function which may be inlined.
+ */
+struct Inlinable {
+  const FuncStmt* func;
+  const Expr* value;             /**< Returned by the function. */
+  std::vector<std::size_t> uses; /**< Of each parameter in value. */
+  std::vector<EvaluationOrder::FirstRead>
+      reads; /**< Of each parameter in value. */
+};
+
+std::optional<Inlinable> as_inlinable(const FuncStmt& func) {
+  const auto* body = dynamic_cast<const BlockStmt*>(func.body.get());
+  if (!is_value_type(func.return_type.type) || !body ||
+      body->statements.size() != 1) {
+    return std::nullopt;
+  }
+  const auto* ret =
+      dynamic_cast<const ReturnStmt*>(body->statements.front().get());
+  if (!ret || !ret->value) {
+    return std::nullopt;
+  }
+
+  var_types_t params(1);
+  for (const auto& param : func.params) {
+    if (!is_value_type(param->type.type) ||
+        !params.front().emplace(param->identifier, param->type.type).second) {
+      return std::nullopt;
+    }
+  }
+  if (type_of(*ret->value, params) != func.return_type.type) {
+    return std::nullopt;
+  }
+
+  // returned variable would be evaluated to the variable, not its value
+  const Expr* value = ret->value.get();
+  while (const auto* grouping = dynamic_cast<const GroupingExpr*>(value)) {
+    value = grouping->expr.get();
+  }
+  if (dynamic_cast<const VarExpr*>(value)) {
+    return std::nullopt;
+  }
+
+  UseCounter counter;
+  ret->value->accept(counter);
+  if (counter.size > MAX_INLINED_SIZE) {
+    return std::nullopt;
+  }
+  // every argument is evaluated by a call, and so must be its substitute
+  std::vector<std::size_t> uses;
+  for (const auto& param : func.params) {
+    uses.push_back(counter.uses[param->identifier]);
+    if (uses.back() == 0) {
+      return std::nullopt;
+    }
+  }
+  EvaluationOrder order;
+  ret->value->accept(order);
+  std::vector<EvaluationOrder::FirstRead> reads;
+  for (const auto& param : func.params) {
+    reads.push_back(order.first_reads.at(param->identifier));
+  }
+  return Inlinable{&func, ret->value.get(), std::move(uses), std::move(reads)};
+}
+
+/**
+ * @brief Inlines calls in visited program, tracking types of variables
+ * declared in lexical scopes, which are the ones found when running.
+ */
+class Inliner : public MutableASTWalker {
+  std::map<std::string, Inlinable> functions_; /**< Defined before visited
+                                                  statement. */
+  var_types_t vars_;
+  std::size_t inlined_ = 0;
+
+  void declare(const std::string& name, const VarType& type) {
+    if (is_value_type(type.type)) {
+      vars_.back().insert_or_assign(name, type.type);
+    }
+  }
+
+  void walk_scoped(const std::string& name, const VarType& type, Stmt* body) {
+    vars_.emplace_back();
+    declare(name, type);
+    walk(body);
+    vars_.pop_back();
+  }
+
+  void try_inline(CallExpr& call) {
+    auto found = functions_.find(call.identifier);
+    if (found == functions_.end()) {
+      return;
+    }
+    const auto& [func, value, uses, reads] = found->second;
+    if (call.arguments.size() != func->params.size()) {
+      return;
+    }
+
+    args_t args;
+    std::optional<std::size_t> last_read;
+    for (std::size_t i = 0; i < uses.size(); ++i) {
+      const Expr& arg = *call.arguments[i];
+      // mismatched arguments are left for the call to report
+      if (type_of(arg, vars_) != func->params[i]->type.type) {
+        return;
+      }
+      bool single = dynamic_cast<const LiteralExpr*>(&arg) ||
+                    dynamic_cast<const VarExpr*>(&arg);
+      if (!single && uses[i] > 1) {
+        return;
+      }
+      // call evaluates such arguments in order before the body, so their
+      // substitutes must be too, for errors to stay the same
+      if (!single) {
+        const auto& read = reads[i];
+        if (read.failing_before > 0 || (last_read && read.order < *last_read)) {
+          return;
+        }
+        last_read = read.order;
+      }
+      args.emplace(func->params[i]->identifier, &arg);
+    }
+
+    call.inlined = Substituter(args).copy(*value);
+    ++inlined_;
+  }
+
+ public:
+  std::size_t run(Program& program) {
+    // functions defined twice fail at the second definition
+    std::map<std::string, std::size_t> definitions;
+    for (const auto& stmt : program.statements) {
+      if (const auto* func = dynamic_cast<const FuncStmt*>(stmt.get())) {
+        ++definitions[func->identifier];
+      }
+    }
+
+    vars_.emplace_back();
+    for (const auto& stmt : program.statements) {
+      walk(stmt.get());
+      const auto* func = dynamic_cast<const FuncStmt*>(stmt.get());
+      if (func && definitions[func->identifier] == 1) {
+        if (auto inlinable = as_inlinable(*func)) {
+          functions_.emplace(func->identifier, std::move(*inlinable));
+        }
+      }
+    }
+    return inlined_;
+  }
+
+  void visit(BlockStmt& stmt) override {
+    vars_.emplace_back();
+    MutableASTWalker::visit(stmt);
+    vars_.pop_back();
+  }
+
+  // other variables seen by a function depend on its caller
+  void visit(FuncStmt& stmt) override {
+    auto outer = std::exchange(vars_, var_types_t(1));
+    for (const auto& param : stmt.params) {
+      declare(param->identifier, param->type);
+    }
+    walk(stmt.body.get());
+    vars_ = std::move(outer);
+  }
+
+  void visit(VarDeclStmt& stmt) override {
+    MutableASTWalker::visit(stmt);
+    declare(stmt.identifier, stmt.type);
+  }
+
+  void visit(ForStmt& stmt) override {
+    walk(stmt.iterable.get());
+    walk_scoped(stmt.identifier, stmt.type, stmt.body.get());
+  }
+
+  void visit(ForRangeStmt& stmt) override {
+    walk(stmt.begin.get());
+    walk(stmt.end.get());
+    walk_scoped(stmt.identifier, VarType(INT), stmt.body.get());
+  }
+
+  void visit(LambdaFuncStmt& stmt) override {
+    walk_scoped(stmt.identifier, stmt.type, stmt.body.get());
+  }
+
+  void visit(CallExpr& expr) override {
+    MutableASTWalker::visit(expr);
+    try_inline(expr);
+  }
+};
+
+}  // namespace
+
+std::size_t inline_calls(Program& program) { return Inliner().run(program); }
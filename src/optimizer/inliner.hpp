@@ -0,0 +1,30 @@
+/*! @file inliner.hpp
+    @brief Inlining of small functions.
+*/
+
+#ifndef BOALANG_INLINER_HPP
+#define BOALANG_INLINER_HPP
+
+#include <cstddef>
+
+#include "stmt/stmt.hpp"
+
+static constexpr std::size_t MAX_INLINED_SIZE =
+    16; /**< Most expressions in returned value of inlined function. */
+
+/**
+ * @brief Sets \ref CallExpr.inlined of calls to small functions.
+ *
+ * Inlined functions are defined once in the outermost scope of \p program,
+ * take and return values of builtin types and only return an expression of
+ * literals, operators and all of their parameters. They are inlined at call
+ * sites following their definition, when types of arguments are known from
+ * declarations in the same function. An argument which is not a literal or
+ * a variable is only substituted for a parameter used once, read in the
+ * order of parameters before any operation which may fail.
+ *
+ * @return Number of inlined call sites.
+ */
+std::size_t inline_calls(Program& program);
+
+#endif  // BOALANG_INLINER_HPP
@@ -0,0 +1,15 @@
+#include "optimizer.hpp"
+
+#include "optimizer/dead_code.hpp"
+#include "optimizer/escape.hpp"
+#include "optimizer/inliner.hpp"
+
+OptimizerStats optimize(Program& program) {
+  OptimizerStats stats;
+  stats.unreachable_statements = remove_unreachable_statements(program);
+  stats.inlined_calls = inline_calls(program);
+  // after inlining, which may leave functions without calls
+  stats.unused_declarations = remove_unused_declarations(program);
+  stats.local_lists = find_local_lists(program);
+  return stats;
+}
@@ -0,0 +1,34 @@
+/*! @file optimizer.hpp
+    @brief Optimization passes over parsed programs.
+*/
+
+#ifndef BOALANG_OPTIMIZER_HPP
+#define BOALANG_OPTIMIZER_HPP
+
+#include <cstddef>
+
+#include "stmt/stmt.hpp"
+
+/**
+ * @brief Changes made by optimize().
+ */
+struct OptimizerStats {
+  std::size_t inlined_calls = 0; /**< Call sites evaluating body of called
+                                    function in place of the call. */
+  std::size_t local_lists = 0;   /**< Initializer lists evaluated into
+                                    reused storage. */
+  std::size_t unreachable_statements = 0; /**< Removed statements following
+                                             a return. */
+  std::size_t unused_declarations = 0;    /**< Removed functions and types,
+                                             never called nor named. */
+};
+
+/**
+ * @brief Runs optimization passes over \p program.
+ *
+ * Output and errors of the program stay the same, only the steps counted by
+ * execution limits, the depth of calls and the memory held may be lower.
+ */
+OptimizerStats optimize(Program& program);
+
+#endif  // BOALANG_OPTIMIZER_HPP
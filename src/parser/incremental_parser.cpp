@@ -0,0 +1,220 @@
+#include "incremental_parser.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+
+#include "ast/astwalker.hpp"
+#include "lexer/lexer.hpp"
+#include "parser/parser.hpp"
+#include "parser/segmenter.hpp"
+#include "utils/errors.hpp"
+
+namespace {
+
+/**
+ * @brief Moves positions of text following \ref PositionShifter.from_ so that
+ * it follows \ref PositionShifter.to_ instead.
+ */
+class PositionShifter : public MutableASTWalker {
+  Position from_;
+  Position to_;
+
+ protected:
+  void enter(Expr& expr) override { shift(expr.position); }
+  void enter(Stmt& stmt) override { shift(stmt.position); }
+
+ public:
+  PositionShifter(Position from, Position to) : from_(from), to_(to) {}
+
+  void shift(Position& position) const {
+    if (position.line == from_.line) {
+      position.column = position.column - from_.column + to_.column;
+    }
+    position.line = position.line - from_.line + to_.line;
+  }
+};
+
+/**
+ * @brief Converts positions of characters in text into offsets, as long as
+ * they are queried in increasing order.
+ */
+class OffsetCursor {
+  std::string_view text_;
+  Position line_start_;    /**< Position preceding current line. */
+  std::size_t offset_ = 0; /**< Offset of current line. */
+
+ public:
+  OffsetCursor(std::string_view text, Position start)
+      : text_(text), line_start_(start) {}
+
+  std::size_t offset_of(Position position) {
+    while (line_start_.line < position.line) {
+      offset_ = text_.find('\n', offset_) + 1;
+      ++line_start_.line;
+      line_start_.column = 0;
+    }
+    return offset_ + position.column - line_start_.column - 1;
+  }
+};
+
+}  // namespace
+
+IncrementalParser::IncrementalParser(const std::string& text)
+    : text_(Source(text).remaining()), chunks_{{0, Position{1, 0}, 0}} {}
+
+std::optional<IncrementalParser::Region> IncrementalParser::parse_region(
+    std::string_view text, std::size_t begin, std::size_t end, Position start,
+    bool strict) {
+  std::string_view region = text.substr(begin, end - begin);
+  try {
+    StringSource source(std::string(region), start);
+    Lexer lexer(source);
+    std::vector<Token> tokens;
+    TokenType last_type = TOKEN_ETX;
+    while (true) {
+      Token token = lexer.next_token();
+      TokenType type = token.get_type();
+      if (type != TOKEN_COMMENT) {
+        tokens.push_back(std::move(token));
+      }
+      if (type == TOKEN_ETX) {
+        break;
+      }
+      last_type = type;
+    }
+    // region ends with a statement terminator unless it has been swallowed,
+    // e.g. by a comment continuing in the text that follows
+    if (end < text.size() && last_type != TOKEN_SEMICOLON &&
+        last_type != TOKEN_RBRACE) {
+      return std::nullopt;
+    }
+
+    std::vector<std::size_t> ends = find_statement_ends(tokens);
+    std::vector<Position> end_positions;
+    end_positions.reserve(ends.size());
+    for (std::size_t index : ends) {
+      end_positions.push_back(tokens[index].get_position());
+    }
+    Position end_position =
+        tokens.size() > 1 ? tokens[tokens.size() - 2].get_position() : start;
+
+    auto program = Parser(std::move(tokens)).parse();
+    Region result{{}, std::move(program->statements), end_position};
+    std::size_t count = result.statements.size();
+    if (count == 0 || end_positions.size() != count) {
+      result.chunks.push_back({begin, start, count});
+      return result;
+    }
+
+    OffsetCursor cursor(region, start);
+    Chunk chunk{begin, start, 1};
+    for (std::size_t i = 0; i < count; ++i) {
+      result.chunks.push_back(chunk);
+      chunk.start = end_positions[i];
+      chunk.offset = begin + cursor.offset_of(chunk.start) + 1;
+    }
+    return result;
+  } catch (const LexerError&) {
+    if (strict) {
+      throw;
+    }
+  } catch (const SyntaxError&) {
+    if (strict) {
+      throw;
+    }
+  }
+  return std::nullopt;
+}
+
+std::size_t IncrementalParser::chunk_at(std::size_t offset) const {
+  auto it = std::upper_bound(chunks_.begin(), chunks_.end(), offset,
+                             [](std::size_t value, const Chunk& chunk) {
+                               return value < chunk.offset;
+                             });
+  return static_cast<std::size_t>(std::distance(chunks_.begin(), it)) - 1;
+}
+
+std::unique_ptr<Program> IncrementalParser::parse() {
+  Region region =
+      parse_region(text_, 0, text_.size(), Position{1, 0}, true).value();
+  chunks_ = std::move(region.chunks);
+  return std::make_unique<Program>(std::move(region.statements),
+                                   Position{0, 0});
+}
+
+void IncrementalParser::reparse(Program& program, const TextEdit& edit) {
+  if (edit.offset > text_.size() || edit.length > text_.size() - edit.offset) {
+    throw std::out_of_range("Edit outside of source text.");
+  }
+  std::string replacement(Source(edit.replacement).remaining());
+  std::string removed = text_.substr(edit.offset, edit.length);
+  std::size_t old_size = text_.size();
+  text_.replace(edit.offset, edit.length, replacement);
+
+  // chunks touching the edit, including the one ending right before it
+  std::size_t first = chunk_at(edit.offset > 0 ? edit.offset - 1 : 0);
+  std::size_t last = chunk_at(edit.offset + edit.length);
+  std::optional<Region> region;
+  try {
+    while (true) {
+      bool whole = first == 0 && last + 1 == chunks_.size();
+      std::size_t end =
+          (last + 1 < chunks_.size() ? chunks_[last + 1].offset : old_size) +
+          replacement.size() - edit.length;
+      region = parse_region(text_, chunks_[first].offset, end,
+                            chunks_[first].start, whole);
+      if (region) {
+        break;
+      }
+      std::size_t width = last - first + 1;
+      first -= std::min(first, width);
+      last = std::min(last + width, chunks_.size() - 1);
+    }
+  } catch (...) {
+    text_.replace(edit.offset, replacement.size(), removed);
+    throw;
+  }
+
+  auto statements_in = [this](std::size_t from, std::size_t to) {
+    return std::accumulate(chunks_.begin() + static_cast<std::ptrdiff_t>(from),
+                           chunks_.begin() + static_cast<std::ptrdiff_t>(to),
+                           std::size_t{0},
+                           [](std::size_t sum, const Chunk& chunk) {
+                             return sum + chunk.statements;
+                           });
+  };
+  auto statement = program.statements.begin() +
+                   static_cast<std::ptrdiff_t>(statements_in(0, first));
+  statement = program.statements.erase(
+      statement,
+      statement + static_cast<std::ptrdiff_t>(statements_in(first, last + 1)));
+  statement = program.statements.insert(
+      statement, std::make_move_iterator(region->statements.begin()),
+      std::make_move_iterator(region->statements.end()));
+  statement += static_cast<std::ptrdiff_t>(region->statements.size());
+
+  if (last + 1 < chunks_.size()) {
+    Position from = chunks_[last + 1].start;
+    PositionShifter shifter(from, region->end);
+    for (std::size_t i = last + 1; i < chunks_.size(); ++i) {
+      Chunk& chunk = chunks_[i];
+      chunk.offset = chunk.offset + replacement.size() - edit.length;
+      // with line numbers unchanged only the rest of the edited line moves
+      if (from.line == region->end.line && chunk.start.line != from.line) {
+        statement += static_cast<std::ptrdiff_t>(chunk.statements);
+        continue;
+      }
+      for (std::size_t j = 0; j < chunk.statements; ++j, ++statement) {
+        (*statement)->accept(shifter);
+      }
+      shifter.shift(chunk.start);
+    }
+  }
+
+  chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(first),
+                chunks_.begin() + static_cast<std::ptrdiff_t>(last + 1));
+  chunks_.insert(chunks_.begin() + static_cast<std::ptrdiff_t>(first),
+                 region->chunks.begin(), region->chunks.end());
+}
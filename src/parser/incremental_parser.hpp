@@ -0,0 +1,106 @@
+/*! @file incremental_parser.hpp
+    @brief Reparsing of edited sources.
+*/
+
+#ifndef BOALANG_INCREMENTAL_PARSER_HPP
+#define BOALANG_INCREMENTAL_PARSER_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "stmt/stmt.hpp"
+#include "utils/position.hpp"
+
+/**
+ * @brief Replacement of \ref TextEdit.length characters starting at
+ * \ref TextEdit.offset of normalized source text.
+ */
+struct TextEdit {
+  std::size_t offset;
+  std::size_t length;
+  std::string replacement;
+};
+
+/**
+ * @brief Parser keeping source text and top-level statement layout, so that
+ * edits reparse only the statements they touch.
+ *
+ * Text is divided into chunks, each ending with the last character of a
+ * top-level statement (the last chunk extends to the end of text). Chunk
+ * boundaries are always token boundaries outside of comments, so an edited
+ * region spanning whole chunks can be lexed and parsed on its own. If it
+ * cannot, e.g. because the edit opened a comment, the region grows until it
+ * can or the whole text has to be parsed.
+ *
+ * Statements outside of the region are kept, only their positions get
+ * shifted. Produces the same AST as Parser would for the edited text.
+ */
+class IncrementalParser {
+  /**
+   * @brief Part of text holding whole top-level statements.
+   */
+  struct Chunk {
+    std::size_t offset;     /**< Offset of the first character. */
+    Position start;         /**< Position preceding the first character. */
+    std::size_t statements; /**< Number of top-level statements. */
+  };
+
+  /**
+   * @brief Parsed region of text.
+   */
+  struct Region {
+    std::vector<Chunk> chunks;
+    std::vector<std::unique_ptr<Stmt>> statements;
+    Position end; /**< Position of the last character. */
+  };
+
+  std::string text_;          /**< Normalized source text. */
+  std::vector<Chunk> chunks_; /**< Chunks covering \ref text_. */
+
+  /**
+   * @brief Lexes and parses [\p begin, \p end) of \p text starting at \p start.
+   *
+   * @param strict Whether to propagate errors instead of returning nullopt.
+   * @return Parsed region, or nullopt if it cannot be parsed separately from
+   * the rest of \p text.
+   */
+  static std::optional<Region> parse_region(std::string_view text,
+                                            std::size_t begin, std::size_t end,
+                                            Position start, bool strict);
+
+  /**
+   * @return Index of chunk containing character at \p offset.
+   */
+  [[nodiscard]] std::size_t chunk_at(std::size_t offset) const;
+
+ public:
+  /**
+   * @brief Constructs parser of \p text, normalized as by Source.
+   */
+  explicit IncrementalParser(const std::string& text);
+
+  /**
+   * @brief Parses the whole text and produces AST.
+   *
+   * @return Unique_ptr to Program statement (root of the AST).
+   */
+  std::unique_ptr<Program> parse();
+
+  /**
+   * @brief Applies \p edit to the text and updates \p program in place.
+   *
+   * \p program has to be the result of parse() and following reparse() calls.
+   * On error both the text and \p program are left unchanged.
+   *
+   * @throws std::out_of_range When \p edit lies outside of the text.
+   * @throws LexerError, SyntaxError When the edited text is invalid.
+   */
+  void reparse(Program& program, const TextEdit& edit);
+
+  [[nodiscard]] const std::string& text() const { return text_; }
+};
+
+#endif  // BOALANG_INCREMENTAL_PARSER_HPP
@@ -0,0 +1,65 @@
+#include "parallel_parser.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <iterator>
+
+#include "parser/parser.hpp"
+#include "parser/segmenter.hpp"
+
+constexpr std::size_t RANGES_PER_THREAD =
+    4; /**< Extra ranges balancing uneven statement sizes. */
+
+std::vector<std::size_t> ParallelParser::split(std::size_t ranges) const {
+  std::size_t range_size =
+      std::max(tokens_.size() / ranges + 1, MIN_PARALLEL_PARSE_TOKENS);
+
+  std::vector<std::size_t> starts{0};
+  for (std::size_t end : find_statement_ends(tokens_)) {
+    if (end + 1 - starts.back() >= range_size) {
+      starts.push_back(end + 1);
+    }
+  }
+  return starts;
+}
+
+std::unique_ptr<Program> ParallelParser::parse() {
+  std::vector<std::size_t> starts = split(pool_.size() * RANGES_PER_THREAD);
+  if (starts.size() == 1) {
+    return Parser(std::move(tokens_)).parse();
+  }
+  starts.push_back(tokens_.size() - 1);  // TOKEN_ETX
+
+  std::vector<std::future<std::unique_ptr<Program>>> results;
+  for (std::size_t i = 0; i + 1 < starts.size(); ++i) {
+    results.push_back(
+        pool_.submit([this, begin = starts[i], end = starts[i + 1]]() {
+          std::vector<Token> range(
+              tokens_.begin() + static_cast<std::ptrdiff_t>(begin),
+              tokens_.begin() + static_cast<std::ptrdiff_t>(end));
+          range.push_back(tokens_.back());
+          try {
+            return Parser(std::move(range)).parse();
+          } catch (const std::exception&) {
+            return std::unique_ptr<Program>();
+          }
+        }));
+  }
+
+  std::vector<std::unique_ptr<Stmt>> statements;
+  bool failed = false;
+  for (auto& result : results) {
+    auto program = result.get();
+    if (!program) {
+      failed = true;
+      continue;
+    }
+    std::move(program->statements.begin(), program->statements.end(),
+              std::back_inserter(statements));
+  }
+  if (failed) {
+    return Parser(std::move(tokens_)).parse();
+  }
+  return std::make_unique<Program>(std::move(statements), Position{0, 0});
+}
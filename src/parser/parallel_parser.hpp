@@ -0,0 +1,51 @@
+/*! @file parallel_parser.hpp
+    @brief Multithreaded parsing of top-level statements.
+*/
+
+#ifndef BOALANG_PARALLEL_PARSER_HPP
+#define BOALANG_PARALLEL_PARSER_HPP
+
+#include <memory>
+#include <vector>
+
+#include "stmt/stmt.hpp"
+#include "token/token.hpp"
+#include "utils/thread_pool.hpp"
+
+constexpr std::size_t MIN_PARALLEL_PARSE_TOKENS =
+    1 << 12; /**< Token ranges are not split finer than this. */
+
+/**
+ * @brief Parser splitting token buffer into ranges of top-level statements
+ * parsed on a thread pool.
+ *
+ * Statement boundaries are found with find_statement_ends(). If any range
+ * fails to parse, the whole buffer is parsed sequentially,
+ * so the reported SyntaxError is always the earliest one in the source.
+ *
+ * Produces the same AST as Parser.
+ */
+class ParallelParser {
+  std::vector<Token> tokens_; /**< Tokens terminated with TOKEN_ETX. */
+  ThreadPool& pool_;          /**< Pool parsing the ranges. */
+
+  /**
+   * @brief Splits \ref ParallelParser.tokens_ at top-level statement
+   * boundaries into at most \p ranges ranges.
+   * @return Range start indices, beginning with 0.
+   */
+  [[nodiscard]] std::vector<std::size_t> split(std::size_t ranges) const;
+
+ public:
+  ParallelParser(std::vector<Token> tokens, ThreadPool& pool)
+      : tokens_(std::move(tokens)), pool_(pool){};
+
+  /**
+   * @brief Parses tokens and produces AST.
+   *
+   * @return Unique_ptr to Program statement (root of the AST).
+   */
+  std::unique_ptr<Program> parse();
+};
+
+#endif  // BOALANG_PARALLEL_PARSER_HPP
@@ -1,15 +1,82 @@
 #include "parser.hpp"
 
 #include <algorithm>
+#include <array>
 
 constexpr unsigned int MAX_ARGUMENTS =
     256; /**< Maximum number of function arguments supported by parser. */
 
+/**
+ * @brief Binding powers of binary operators indexed by token type, 0 for
+ * other tokens. Operators with higher power bind tighter.
+ */
+constexpr auto BINDING_POWERS = [] {
+  std::array<unsigned int, TOKEN_UNKNOWN + 1> powers{};
+  powers[TOKEN_OR] = 1;
+  powers[TOKEN_AND] = 2;
+  powers[TOKEN_NOT_EQUAL] = powers[TOKEN_EQUAL_EQUAL] = 3;
+  powers[TOKEN_GREATER] = powers[TOKEN_GREATER_EQUAL] = powers[TOKEN_LESS] =
+      powers[TOKEN_LESS_EQUAL] = 4;
+  powers[TOKEN_MINUS] = powers[TOKEN_PLUS] = 5;
+  powers[TOKEN_SLASH] = powers[TOKEN_STAR] = 6;
+  return powers;
+}();
+
+/**
+ * @brief Builds binary expression for operator token of type \p type.
+ */
+static std::unique_ptr<Expr> make_binary(TokenType type,
+                                         std::unique_ptr<Expr> left,
+                                         std::unique_ptr<Expr> right,
+                                         Position position) {
+  switch (type) {
+    case TOKEN_OR:
+      return std::make_unique<LogicalOrExpr>(std::move(left), std::move(right),
+                                             position);
+    case TOKEN_AND:
+      return std::make_unique<LogicalAndExpr>(std::move(left), std::move(right),
+                                              position);
+    case TOKEN_NOT_EQUAL:
+      return std::make_unique<NotEqualCompExpr>(std::move(left),
+                                                std::move(right), position);
+    case TOKEN_EQUAL_EQUAL:
+      return std::make_unique<EqualCompExpr>(std::move(left), std::move(right),
+                                             position);
+    case TOKEN_GREATER:
+      return std::make_unique<GreaterCompExpr>(std::move(left),
+                                               std::move(right), position);
+    case TOKEN_GREATER_EQUAL:
+      return std::make_unique<GreaterEqualCompExpr>(std::move(left),
+                                                    std::move(right), position);
+    case TOKEN_LESS:
+      return std::make_unique<LessCompExpr>(std::move(left), std::move(right),
+                                            position);
+    case TOKEN_LESS_EQUAL:
+      return std::make_unique<LessEqualCompExpr>(std::move(left),
+                                                 std::move(right), position);
+    case TOKEN_MINUS:
+      return std::make_unique<SubtractionExpr>(std::move(left),
+                                               std::move(right), position);
+    case TOKEN_PLUS:
+      return std::make_unique<AdditionExpr>(std::move(left), std::move(right),
+                                            position);
+    case TOKEN_SLASH:
+      return std::make_unique<DivisionExpr>(std::move(left), std::move(right),
+                                            position);
+    case TOKEN_STAR:
+      return std::make_unique<MultiplicationExpr>(std::move(left),
+                                                  std::move(right), position);
+    default:
+      return nullptr;
+  }
+}
+
 const std::initializer_list<std::unique_ptr<Stmt> (Parser::*)()>
     Parser::stmt_handlers = {
-        &Parser::if_stmt,     &Parser::while_stmt,   &Parser::return_stmt,
-        &Parser::print_stmt,  &Parser::inspect_stmt, &Parser::block_stmt,
-        &Parser::struct_decl, &Parser::variant_decl, &Parser::var_or_func,
+        &Parser::if_stmt,     &Parser::while_stmt,  &Parser::for_stmt,
+        &Parser::return_stmt, &Parser::print_stmt,  &Parser::inspect_stmt,
+        &Parser::block_stmt,  &Parser::struct_decl, &Parser::variant_decl,
+        &Parser::var_or_func,
 };
 
 const std::initializer_list<std::unique_ptr<Stmt> (Parser::*)()>
@@ -35,13 +102,14 @@ std::unique_ptr<Program> Parser::parse() {
     statements.push_back(std::move(stmt));
   }
   if (!match(TOKEN_ETX)) {
-    throw SyntaxError(current_token_, "Expected statement or declaration.");
+    throw SyntaxError(peek(), "Expected statement or declaration.");
   }
   return std::make_unique<Program>(std::move(statements), Position{0, 0});
 }
 
 // RULE statement = if_stmt
 //                | while_stmt
+//                | for_stmt
 //                | return_stmt
 //                | print_stmt
 //                | inspect_stmt
@@ -59,19 +127,18 @@ std::unique_ptr<Stmt> Parser::if_stmt() {
     consume("Expected '(' after 'if'.", TOKEN_LPAREN);
     std::unique_ptr<Expr> condition = expression();
     if (!condition) {
-      throw SyntaxError(current_token_, "Expected if condition statement.");
+      throw SyntaxError(peek(), "Expected if condition statement.");
     }
     consume("Expected ')' after condition.", TOKEN_RPAREN);
     std::unique_ptr<Stmt> then_branch = statement();
     if (!then_branch) {
-      throw SyntaxError(current_token_, "Expected if's then branch statement.");
+      throw SyntaxError(peek(), "Expected if's then branch statement.");
     }
     std::unique_ptr<Stmt> else_branch;
     if (match(TOKEN_ELSE)) {
       else_branch = statement();
       if (!else_branch) {
-        throw SyntaxError(current_token_,
-                          "Expected if's else branch statement.");
+        throw SyntaxError(peek(), "Expected if's else branch statement.");
       }
     }
     return std::make_unique<IfStmt>(
@@ -87,12 +154,12 @@ std::unique_ptr<Stmt> Parser::while_stmt() {
     consume("Expected '(' after 'while'.", TOKEN_LPAREN);
     std::unique_ptr<Expr> condition = expression();
     if (!condition) {
-      throw SyntaxError(current_token_, "Expected condition expression.");
+      throw SyntaxError(peek(), "Expected condition expression.");
     }
     consume("Expected ')' after while condition.", TOKEN_RPAREN);
     std::unique_ptr<Stmt> body = statement();
     if (!body) {
-      throw SyntaxError(current_token_, "Expected body statement.");
+      throw SyntaxError(peek(), "Expected body statement.");
     }
 
     return std::make_unique<WhileStmt>(std::move(condition), std::move(body),
@@ -101,6 +168,50 @@ std::unique_ptr<Stmt> Parser::while_stmt() {
   return nullptr;
 }
 
+// RULE for_stmt = "for" "(" type identifier "in" expression [ ".." expression ]
+// ")" statement ;
+std::unique_ptr<Stmt> Parser::for_stmt() {
+  if (auto token = match(TOKEN_FOR)) {
+    consume("Expected '(' after 'for'.", TOKEN_LPAREN);
+    auto var_type = type();
+    if (!var_type) {
+      throw SyntaxError(peek(), "Expected loop variable type.");
+    }
+    Token identifier = consume("Expected identifier after loop variable type.",
+                               TOKEN_IDENTIFIER);
+    consume("Expected 'in' after loop variable.", TOKEN_IN);
+    std::unique_ptr<Expr> iterable = expression();
+    if (!iterable) {
+      throw SyntaxError(peek(), "Expected iterated expression.");
+    }
+    std::unique_ptr<Expr> end;
+    if (auto range = match(TOKEN_DOT_DOT)) {
+      if (var_type->type != INT) {
+        throw SyntaxError(*range, "Expected int loop variable in range loop.");
+      }
+      end = expression();
+      if (!end) {
+        throw SyntaxError(peek(), "Expected expression after '..'.");
+      }
+    }
+    consume("Expected ')' after iterated expression.", TOKEN_RPAREN);
+    std::unique_ptr<Stmt> body = statement();
+    if (!body) {
+      throw SyntaxError(peek(), "Expected body statement.");
+    }
+
+    if (end) {
+      return std::make_unique<ForRangeStmt>(
+          identifier.stringify(), std::move(iterable), std::move(end),
+          std::move(body), token->get_position());
+    }
+    return std::make_unique<ForStmt>(
+        std::move(*var_type), identifier.stringify(), std::move(iterable),
+        std::move(body), token->get_position());
+  }
+  return nullptr;
+}
+
 // RULE return_stmt = "return" [ expression ] ";" ;
 std::unique_ptr<Stmt> Parser::return_stmt() {
   if (auto token = match(TOKEN_RETURN)) {
@@ -108,8 +219,7 @@ std::unique_ptr<Stmt> Parser::return_stmt() {
     if (!match(TOKEN_SEMICOLON)) {
       value = expression();
       if (!value) {
-        throw SyntaxError(current_token_,
-                          "Expected expression after 'return'.");
+        throw SyntaxError(peek(), "Expected expression after 'return'.");
       }
       consume("Expected ';' after returned expression.", TOKEN_SEMICOLON);
     }
@@ -124,7 +234,7 @@ std::unique_ptr<Stmt> Parser::print_stmt() {
   if (auto token = match(TOKEN_PRINT)) {
     std::unique_ptr<Expr> expr = expression();
     if (!expr) {
-      throw SyntaxError(current_token_, "Expected expression after 'print'.");
+      throw SyntaxError(peek(), "Expected expression after 'print'.");
     }
     consume("Expected ';' after printed expression.", TOKEN_SEMICOLON);
     return std::make_unique<PrintStmt>(std::move(expr), token->get_position());
@@ -138,7 +248,7 @@ std::unique_ptr<Stmt> Parser::inspect_stmt() {
   if (auto token = match(TOKEN_INSPECT)) {
     std::unique_ptr<Expr> inspected = expression();
     if (!inspected) {
-      throw SyntaxError(current_token_, "Expected expression after 'inspect'.");
+      throw SyntaxError(peek(), "Expected expression after 'inspect'.");
     }
     consume("Expected '{' after inspected expression.", TOKEN_LBRACE);
     std::vector<std::unique_ptr<LambdaFuncStmt>> lambdas;
@@ -151,8 +261,7 @@ std::unique_ptr<Stmt> Parser::inspect_stmt() {
       consume("Expected '=>' after default lambda.", TOKEN_ARROW);
       default_lambda = block_stmt();
       if (!default_lambda) {
-        throw SyntaxError(current_token_,
-                          "Expected block statement after '=>'.");
+        throw SyntaxError(peek(), "Expected block statement after '=>'.");
       }
     }
     consume("Expected '}' after inspect lambdas.", TOKEN_RBRACE);
@@ -165,7 +274,7 @@ std::unique_ptr<Stmt> Parser::inspect_stmt() {
 
 // RULE lambda_func = type identifier "=>" block_stmt
 std::unique_ptr<LambdaFuncStmt> Parser::lambda_func() {
-  std::optional<Token> lambda_type = type();
+  std::optional<VarType> lambda_type = type();
   if (!lambda_type) {
     return nullptr;
   }
@@ -174,11 +283,11 @@ std::unique_ptr<LambdaFuncStmt> Parser::lambda_func() {
   consume("Expected '=>' after lambda identifier.", TOKEN_ARROW);
   std::unique_ptr<Stmt> lambda_body = block_stmt();
   if (!lambda_body) {
-    throw SyntaxError(current_token_, "Expected statement for lambda body.");
+    throw SyntaxError(peek(), "Expected statement for lambda body.");
   }
   return std::make_unique<LambdaFuncStmt>(
-      lambda_type->get_var_type(), lambda_id.stringify(),
-      std::move(lambda_body), lambda_id.get_position());
+      std::move(*lambda_type), lambda_id.stringify(), std::move(lambda_body),
+      lambda_id.get_position());
 }
 
 // RULE block_stmt = "{" { statement } "}" ;
@@ -218,17 +327,17 @@ std::unique_ptr<StructFieldStmt> Parser::struct_field() {
   if (match(TOKEN_MUT)) {
     is_mut = true;
   }
-  std::optional<Token> field_type = type();
+  std::optional<VarType> field_type = type();
   if (!field_type) {
     if (is_mut) {
-      throw SyntaxError(current_token_, "Expected struct field type.");
+      throw SyntaxError(peek(), "Expected struct field type.");
     }
     return nullptr;
   }
   Token field_id =
       consume("Expected identifier after struct field type.", TOKEN_IDENTIFIER);
   consume("Expected ';' after struct field.", TOKEN_SEMICOLON);
-  return std::make_unique<StructFieldStmt>(field_type->get_var_type(),
+  return std::make_unique<StructFieldStmt>(std::move(*field_type),
                                            field_id.stringify(),
                                            field_id.get_position(), is_mut);
 }
@@ -244,7 +353,7 @@ std::unique_ptr<Stmt> Parser::variant_decl() {
   if (auto variantparams = variant_params()) {
     params = *variantparams;
   } else {
-    throw SyntaxError(current_token_, "Expected variant parameters.");
+    throw SyntaxError(peek(), "Expected variant parameters.");
   }
   consume("Expected '}' after variant parameters.", TOKEN_RBRACE);
   consume("Expected ';' after variant declaration.", TOKEN_SEMICOLON);
@@ -256,18 +365,18 @@ std::unique_ptr<Stmt> Parser::variant_decl() {
 std::optional<std::vector<VarType>> Parser::variant_params() {
   std::vector<VarType> params;
 
-  if (auto type_token = type()) {
-    params.push_back(type_token->get_var_type());
+  if (auto param_type = type()) {
+    params.push_back(std::move(*param_type));
   } else {
     return std::nullopt;
   }
 
   while (match(TOKEN_COMMA)) {
-    auto type_token = type();
-    if (!type_token) {
-      throw SyntaxError(current_token_, "Expected variant parameter type.");
+    auto param_type = type();
+    if (!param_type) {
+      throw SyntaxError(peek(), "Expected variant parameter type.");
     }
-    params.push_back(type_token->get_var_type());
+    params.push_back(std::move(*param_type));
   }
   return params;
 }
@@ -282,22 +391,30 @@ std::unique_ptr<Stmt> Parser::var_or_func() {
   }
 
   if (auto token = match(TOKEN_IDENTIFIER)) {
-    if (auto assigncall = assign_or_call(*token)) {
-      return assigncall;
+    // "S[] s" and "S[str] s" declare containers, while "s[i] = v" assigns to
+    // an element, as key types are keywords and cannot index
+    bool container_decl = peek().get_type() == TOKEN_LBRACKET &&
+                          (peek(1).get_type() == TOKEN_RBRACKET ||
+                           ((peek(1).get_type() == TOKEN_INT ||
+                             peek(1).get_type() == TOKEN_STR) &&
+                            peek(2).get_type() == TOKEN_RBRACKET));
+    if (!container_decl) {
+      if (auto assigncall = assign_or_call(*token)) {
+        return assigncall;
+      }
     }
-    if (auto varfuncdecl = var_or_func_decl(*token)) {
+    if (auto varfuncdecl =
+            var_or_func_decl(container_type(token->get_var_type()))) {
       return varfuncdecl;
     }
-    throw SyntaxError(current_token_,
-                      "Expected assignment, call or declaration.");
+    throw SyntaxError(peek(), "Expected assignment, call or declaration.");
   }
 
   if (auto decl_type = type()) {
     if (auto varfuncdecl = var_or_func_decl(*decl_type)) {
       return varfuncdecl;
     }
-    throw SyntaxError(current_token_,
-                      "Expected variable or function declaration.");
+    throw SyntaxError(peek(), "Expected variable or function declaration.");
   }
 
   return nullptr;
@@ -316,27 +433,23 @@ std::unique_ptr<Stmt> Parser::assign_or_call(const Token& identifier) {
   return nullptr;
 }
 
-// RULE assign = [ "." field_access ] "=" expression ";" ;
+// RULE assign = access "=" expression ";" ;
 std::unique_ptr<AssignStmt> Parser::assign_stmt(std::unique_ptr<Expr> var) {
-  bool is_field = false;
-
-  if (match(TOKEN_DOT)) {
-    var = field_access(std::move(var));
-    is_field = true;
-  }
+  bool is_access =
+      peek().get_type() == TOKEN_DOT || peek().get_type() == TOKEN_LBRACKET;
+  var = access(std::move(var));
 
   if (auto token = match(TOKEN_EQUAL)) {
     auto value = expression();
     if (!value) {
-      throw SyntaxError(current_token_, "Expected expression for assignment.");
+      throw SyntaxError(peek(), "Expected expression for assignment.");
     }
     consume("Expected ';' after assignment.", TOKEN_SEMICOLON);
     return std::make_unique<AssignStmt>(std::move(var), std::move(value),
                                         token->get_position());
   }
-  if (is_field) {
-    throw SyntaxError(current_token_,
-                      "Expected '=' after field access for assignment.");
+  if (is_access) {
+    throw SyntaxError(peek(), "Expected '=' after access for assignment.");
   }
   return nullptr;
 }
@@ -357,7 +470,7 @@ std::unique_ptr<CallStmt> Parser::call_stmt(const Token& identifier) {
     if (auto args = arguments()) {
       call_args = std::move(*args);
     } else {
-      throw SyntaxError(current_token_, "Expected call arguments.");
+      throw SyntaxError(peek(), "Expected call arguments.");
     }
     consume("Excepted ')' after call arguments.", TOKEN_RPAREN);
   }
@@ -367,7 +480,7 @@ std::unique_ptr<CallStmt> Parser::call_stmt(const Token& identifier) {
 }
 
 // RULE var_or_func_decl = identifier ( var_decl | func_decl ) ;
-std::unique_ptr<Stmt> Parser::var_or_func_decl(const Token& type) {
+std::unique_ptr<Stmt> Parser::var_or_func_decl(const VarType& type) {
   if (auto identifier = match(TOKEN_IDENTIFIER)) {
     if (auto vardecl = var_decl(type, *identifier, false)) {
       return vardecl;
@@ -375,8 +488,7 @@ std::unique_ptr<Stmt> Parser::var_or_func_decl(const Token& type) {
     if (auto funcdecl = func_decl(type, *identifier)) {
       return funcdecl;
     }
-    throw SyntaxError(current_token_,
-                      "Expected variable or function declaration.");
+    throw SyntaxError(peek(), "Expected variable or function declaration.");
   }
   return nullptr;
 }
@@ -388,31 +500,31 @@ std::unique_ptr<Stmt> Parser::mut_var_decl() {
   }
   auto var_type = type();
   if (!var_type) {
-    throw SyntaxError(current_token_, "Expected variable type.");
+    throw SyntaxError(peek(), "Expected variable type.");
   }
   Token identifier =
       consume("Expected identifier after variable type.", TOKEN_IDENTIFIER);
   if (auto vardecl = var_decl(*var_type, identifier, true)) {
     return vardecl;
   }
-  throw SyntaxError(current_token_, "Expected variable declaration.");
+  throw SyntaxError(peek(), "Expected variable declaration.");
 }
 
 // RULE void_func_decl = "void" identifier func_decl ;
 std::unique_ptr<Stmt> Parser::void_func_decl() {
-  if (auto return_type = match(TOKEN_VOID)) {
+  if (match(TOKEN_VOID)) {
     Token identifier = consume(
         "Expected identifier after function return type.", TOKEN_IDENTIFIER);
-    if (auto funcdecl = func_decl(*return_type, identifier)) {
+    if (auto funcdecl = func_decl(VarType(VOID), identifier)) {
       return funcdecl;
     }
-    throw SyntaxError(current_token_, "Expected function declaration.");
+    throw SyntaxError(peek(), "Expected function declaration.");
   }
   return nullptr;
 }
 
 // RULE var_decl = "=" expression ";" ;
-std::unique_ptr<VarDeclStmt> Parser::var_decl(const Token& type,
+std::unique_ptr<VarDeclStmt> Parser::var_decl(const VarType& type,
                                               const Token& identifier,
                                               bool mut) {
   if (!match(TOKEN_EQUAL)) {
@@ -420,16 +532,16 @@ std::unique_ptr<VarDeclStmt> Parser::var_decl(const Token& type,
   }
   std::unique_ptr<Expr> expr = expression();
   if (!expr) {
-    throw SyntaxError(current_token_, "Expected expression.");
+    throw SyntaxError(peek(), "Expected expression.");
   }
   consume("Expected ';' after variable declaration.", TOKEN_SEMICOLON);
-  return std::make_unique<VarDeclStmt>(type.get_var_type(),
-                                       identifier.stringify(), std::move(expr),
+  return std::make_unique<VarDeclStmt>(type, identifier.stringify(),
+                                       std::move(expr),
                                        identifier.get_position(), mut);
 }
 
 // RULE func_decl = "(" [ func_params ] ")" block_stmt ;
-std::unique_ptr<FuncStmt> Parser::func_decl(const Token& return_type,
+std::unique_ptr<FuncStmt> Parser::func_decl(const VarType& return_type,
                                             const Token& identifier) {
   if (!match(TOKEN_LPAREN)) {
     return nullptr;
@@ -439,18 +551,18 @@ std::unique_ptr<FuncStmt> Parser::func_decl(const Token& return_type,
     if (auto funcparams = func_params()) {
       params = std::move(*funcparams);
     } else {
-      throw SyntaxError(current_token_, "Expected function parameters.");
+      throw SyntaxError(peek(), "Expected function parameters.");
     }
     consume("Excepted ')' after function parameters.", TOKEN_RPAREN);
   }
   auto body = block_stmt();
   if (!body) {
-    throw SyntaxError(current_token_,
+    throw SyntaxError(peek(),
                       "Expected block statement in function declaration.");
   }
-  return std::make_unique<FuncStmt>(
-      identifier.stringify(), return_type.get_var_type(), std::move(params),
-      std::move(body), identifier.get_position());
+  return std::make_unique<FuncStmt>(identifier.stringify(), return_type,
+                                    std::move(params), std::move(body),
+                                    identifier.get_position());
 }
 
 // RULE func_params = type identifier { "," type identifier } ;
@@ -461,194 +573,57 @@ Parser::func_params() {
   if (auto param_type = type()) {
     Token param_id =
         consume("Expected identifier after type.", TOKEN_IDENTIFIER);
-    params.push_back(std::make_unique<FuncParamStmt>(param_type->get_var_type(),
-                                                     param_id.stringify(),
-                                                     param_id.get_position()));
+    params.push_back(std::make_unique<FuncParamStmt>(
+        std::move(*param_type), param_id.stringify(), param_id.get_position()));
   } else {
     return std::nullopt;
   }
 
   while (match(TOKEN_COMMA)) {
-    std::optional<Token> param_type = type();
+    std::optional<VarType> param_type = type();
     if (!param_type) {
-      throw SyntaxError(current_token_, "Expected function parameter type.");
+      throw SyntaxError(peek(), "Expected function parameter type.");
     }
     Token param_id =
         consume("Expected identifier after type.", TOKEN_IDENTIFIER);
-    params.push_back(std::make_unique<FuncParamStmt>(param_type->get_var_type(),
-                                                     param_id.stringify(),
-                                                     param_id.get_position()));
+    params.push_back(std::make_unique<FuncParamStmt>(
+        std::move(*param_type), param_id.stringify(), param_id.get_position()));
   }
   return params;
 }
 
 // RULE expression = logic_or ;
-std::unique_ptr<Expr> Parser::expression() { return logic_or(); }
+std::unique_ptr<Expr> Parser::expression() { return binary(0); }
 
 // RULE logic_or = logic_and { "or" logic_and } ;
-std::unique_ptr<Expr> Parser::logic_or() {
-  std::unique_ptr<Expr> expr = logic_and();
-
-  if (!expr) {
-    return nullptr;
-  }
-
-  while (auto token = match(TOKEN_OR)) {
-    std::unique_ptr<Expr> right = logic_and();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
-    }
-    expr = std::make_unique<LogicalOrExpr>(std::move(expr), std::move(right),
-                                           token->get_position());
-  }
-
-  return expr;
-}
-
 // RULE logic_and = equality { "and" equality } ;
-std::unique_ptr<Expr> Parser::logic_and() {
-  std::unique_ptr<Expr> expr = equality();
-
-  if (!expr) {
-    return nullptr;
-  }
-
-  while (auto token = match(TOKEN_AND)) {
-    std::unique_ptr<Expr> right = equality();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
-    }
-    expr = std::make_unique<LogicalAndExpr>(std::move(expr), std::move(right),
-                                            token->get_position());
-  }
-
-  return expr;
-}
-
 // RULE equality = comparison { ( "!=" | "==" ) comparison } ;
-std::unique_ptr<Expr> Parser::equality() {
-  std::unique_ptr<Expr> expr = comparison();
-
-  if (!expr) {
-    return nullptr;
-  }
-
-  while (auto token = match(TOKEN_NOT_EQUAL, TOKEN_EQUAL_EQUAL)) {
-    std::unique_ptr<Expr> right = comparison();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
-    }
-    switch (token->get_type()) {
-      case TOKEN_NOT_EQUAL:
-        expr = std::make_unique<NotEqualCompExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      case TOKEN_EQUAL_EQUAL:
-        expr = std::make_unique<EqualCompExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      default:
-        break;
-    }
-  }
-
-  return expr;
-}
-
 // RULE comparison = term { ( ">" | ">=" | "<" | "<=" ) term } ;
-std::unique_ptr<Expr> Parser::comparison() {
-  std::unique_ptr<Expr> expr = term();
-
-  if (!expr) {
-    return nullptr;
-  }
-
-  while (auto token = match(TOKEN_GREATER, TOKEN_GREATER_EQUAL, TOKEN_LESS,
-                            TOKEN_LESS_EQUAL)) {
-    std::unique_ptr<Expr> right = term();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
-    }
-    switch (token->get_type()) {
-      case TOKEN_GREATER:
-        expr = std::make_unique<GreaterCompExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      case TOKEN_GREATER_EQUAL:
-        expr = std::make_unique<GreaterEqualCompExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      case TOKEN_LESS:
-        expr = std::make_unique<LessCompExpr>(std::move(expr), std::move(right),
-                                              token->get_position());
-        break;
-      case TOKEN_LESS_EQUAL:
-        expr = std::make_unique<LessEqualCompExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      default:
-        break;
-    }
-  }
-
-  return expr;
-}
-
 // RULE term = factor { ( "-" | "+" ) factor } ;
-std::unique_ptr<Expr> Parser::term() {
-  std::unique_ptr<Expr> expr = factor();
-
-  if (!expr) {
-    return nullptr;
-  }
-
-  while (auto token = match(TOKEN_MINUS, TOKEN_PLUS)) {
-    std::unique_ptr<Expr> right = factor();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
-    }
-    switch (token->get_type()) {
-      case TOKEN_MINUS:
-        expr = std::make_unique<SubtractionExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      case TOKEN_PLUS:
-        expr = std::make_unique<AdditionExpr>(std::move(expr), std::move(right),
-                                              token->get_position());
-        break;
-      default:
-        break;
-    }
-  }
-
-  return expr;
-}
-
 // RULE factor = unary { ( "/" | "*" ) unary } ;
-std::unique_ptr<Expr> Parser::factor() {
+std::unique_ptr<Expr> Parser::binary(unsigned int min_power) {
   std::unique_ptr<Expr> expr = unary();
 
   if (!expr) {
     return nullptr;
   }
 
-  while (auto token = match(TOKEN_SLASH, TOKEN_STAR)) {
-    std::unique_ptr<Expr> right = unary();
-    if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
+  while (true) {
+    const Token& token = peek();
+    TokenType type = token.get_type();
+    unsigned int power = BINDING_POWERS[type];
+    if (power <= min_power) {
+      break;
     }
-    switch (token->get_type()) {
-      case TOKEN_SLASH:
-        expr = std::make_unique<DivisionExpr>(std::move(expr), std::move(right),
-                                              token->get_position());
-        break;
-      case TOKEN_STAR:
-        expr = std::make_unique<MultiplicationExpr>(
-            std::move(expr), std::move(right), token->get_position());
-        break;
-      default:
-        break;
+    Position position = token.get_position();
+    advance();
+
+    // all binary operators are left-associative
+    std::unique_ptr<Expr> right = binary(power);
+    if (!right) {
+      throw SyntaxError(peek(), "Expected expression.");
     }
+    expr = make_binary(type, std::move(expr), std::move(right), position);
   }
 
   return expr;
@@ -659,7 +634,7 @@ std::unique_ptr<Expr> Parser::unary() {
   if (auto token = match(TOKEN_EXCLAMATION, TOKEN_MINUS)) {
     std::unique_ptr<Expr> right = type_cast();
     if (!right) {
-      throw SyntaxError(current_token_, "Expected expression.");
+      throw SyntaxError(peek(), "Expected expression.");
     }
     switch (token->get_type()) {
       case TOKEN_EXCLAMATION:
@@ -687,16 +662,16 @@ std::unique_ptr<Expr> Parser::type_cast() {
   while (auto token = match(TOKEN_AS, TOKEN_IS)) {
     auto cast_type = type();
     if (!cast_type) {
-      throw SyntaxError(current_token_, "Expected cast type.");
+      throw SyntaxError(peek(), "Expected cast type.");
     }
     switch (token->get_type()) {
       case TOKEN_AS:
         expr = std::make_unique<AsTypeExpr>(
-            std::move(expr), cast_type->get_var_type(), token->get_position());
+            std::move(expr), std::move(*cast_type), token->get_position());
         break;
       case TOKEN_IS:
         expr = std::make_unique<IsTypeExpr>(
-            std::move(expr), cast_type->get_var_type(), token->get_position());
+            std::move(expr), std::move(*cast_type), token->get_position());
         break;
       default:
         break;
@@ -706,7 +681,7 @@ std::unique_ptr<Expr> Parser::type_cast() {
   return expr;
 }
 
-// RULE call = primary { "(" [ arguments ] ")" | field_access };
+// RULE call = primary [ "(" [ arguments ] ")" ] access ;
 std::unique_ptr<Expr> Parser::call() {
   std::unique_ptr<Expr> expr = primary();
 
@@ -719,26 +694,24 @@ std::unique_ptr<Expr> Parser::call() {
     if (!match(TOKEN_RPAREN)) {
       auto args = arguments();
       if (!args) {
-        throw SyntaxError(current_token_, "Expected arguments in call.");
+        throw SyntaxError(peek(), "Expected arguments in call.");
       }
       call_args = std::move(*args);
       consume("Excepted ')' after call arguments.", TOKEN_RPAREN);
     }
     auto* var = dynamic_cast<VarExpr*>(expr.get());
     if (!var) {
-      throw SyntaxError(current_token_, "Expected identifier as callee.");
+      throw SyntaxError(peek(), "Expected identifier as callee.");
     }
     expr = std::make_unique<CallExpr>(var->identifier, var->position,
                                       std::move(call_args));
-  } else if (match(TOKEN_DOT)) {
-    expr = field_access(std::move(expr));
   }
 
-  return expr;
+  return access(std::move(expr));
 }
 
 // RULE primary = string | int_val | float_val | bool_values | identifier | "("
-// expression ")" | "{" arguments "}" ;
+// expression ")" | "{" [ arguments ] "}" ;
 std::unique_ptr<Expr> Parser::primary() {
   if (auto token = match(TOKEN_FLOAT_VAL, TOKEN_INT_VAL, TOKEN_STR_VAL,
                          TOKEN_TRUE, TOKEN_FALSE)) {
@@ -753,7 +726,7 @@ std::unique_ptr<Expr> Parser::primary() {
   if (auto token = match(TOKEN_LPAREN)) {
     std::unique_ptr<Expr> expr = expression();
     if (!expr) {
-      throw SyntaxError(current_token_, "Expected expression after '('.");
+      throw SyntaxError(peek(), "Expected expression after '('.");
     }
     consume("Excepted ')' after expression.", TOKEN_RPAREN);
     return std::make_unique<GroupingExpr>(std::move(expr),
@@ -761,10 +734,13 @@ std::unique_ptr<Expr> Parser::primary() {
   }
 
   if (auto token = match(TOKEN_LBRACE)) {
+    if (match(TOKEN_RBRACE)) {
+      return std::make_unique<InitalizerListExpr>(
+          std::vector<std::unique_ptr<Expr>>{}, token->get_position());
+    }
     auto args = arguments();
     if (!args) {
-      throw SyntaxError(current_token_,
-                        "Expected arguments for initalizer list.");
+      throw SyntaxError(peek(), "Expected arguments for initalizer list.");
     }
     consume("Excepted '}' after initializer list.", TOKEN_RBRACE);
     return std::make_unique<InitalizerListExpr>(std::move(*args),
@@ -787,9 +763,9 @@ std::optional<std::vector<std::unique_ptr<Expr>>> Parser::arguments() {
   if (match(TOKEN_COMMA)) {
     while (auto expr = expression()) {
       if (args.size() > MAX_ARGUMENTS) {
-        throw SyntaxError(current_token_, "Maximum amount (" +
-                                              std::to_string(MAX_ARGUMENTS) +
-                                              ") of arguments exceeded.");
+        throw SyntaxError(peek(), "Maximum amount (" +
+                                      std::to_string(MAX_ARGUMENTS) +
+                                      ") of arguments exceeded.");
       }
       args.push_back(std::move(expr));
       if (!match(TOKEN_COMMA)) {
@@ -801,39 +777,78 @@ std::optional<std::vector<std::unique_ptr<Expr>>> Parser::arguments() {
   return args;
 }
 
-// RULE field_access = { "." identifier } ;
-std::unique_ptr<Expr> Parser::field_access(
-    std::unique_ptr<Expr> parent_struct) {
-  do {
-    auto id = consume("Expected identifier after '.' for accessing field.",
-                      TOKEN_IDENTIFIER);
-    parent_struct = std::make_unique<FieldAccessExpr>(
-        std::move(parent_struct), id.stringify(), id.get_position());
-  } while (match(TOKEN_DOT));
-  return parent_struct;
+// RULE access = { "." identifier | "[" expression "]" } ;
+std::unique_ptr<Expr> Parser::access(std::unique_ptr<Expr> parent) {
+  while (true) {
+    if (match(TOKEN_DOT)) {
+      auto id = consume("Expected identifier after '.' for accessing field.",
+                        TOKEN_IDENTIFIER);
+      parent = std::make_unique<FieldAccessExpr>(
+          std::move(parent), id.stringify(), id.get_position());
+    } else if (auto token = match(TOKEN_LBRACKET)) {
+      auto index = expression();
+      if (!index) {
+        throw SyntaxError(peek(), "Expected index expression after '['.");
+      }
+      consume("Expected ']' after index expression.", TOKEN_RBRACKET);
+      parent = std::make_unique<IndexExpr>(std::move(parent), std::move(index),
+                                           token->get_position());
+    } else {
+      return parent;
+    }
+  }
 }
 
-// RULE type = "bool" | "str" | "int" | "float" | identifier ;
-std::optional<Token> Parser::type() {
+// RULE type = ( "bool" | "str" | "int" | "float" | identifier )
+// { "[" [ "int" | "str" ] "]" } ;
+std::optional<VarType> Parser::type() {
   if (auto token = match(TOKEN_FLOAT, TOKEN_INT, TOKEN_STR, TOKEN_BOOL,
                          TOKEN_IDENTIFIER)) {
-    return *token;
+    return container_type(token->get_var_type());
   }
 
   return std::nullopt;
 }
 
+VarType Parser::container_type(VarType element) {
+  while (match(TOKEN_LBRACKET)) {
+    if (auto key = match(TOKEN_INT, TOKEN_STR)) {
+      consume("Expected ']' after map key type.", TOKEN_RBRACKET);
+      element = VarType::map_of(key->get_var_type(), std::move(element));
+    } else {
+      consume("Expected ']' after '[' in array type.", TOKEN_RBRACKET);
+      element = VarType::array_of(std::move(element));
+    }
+  }
+  return element;
+}
+
 template <typename... TokenTypes>
 opt_token_t Parser::match(TokenTypes&&... types) {
-  if (((current_token_.get_type() == types) || ...)) {
-    auto prev = current_token_;
+  const Token& token = peek();
+  if (((token.get_type() == types) || ...)) {
+    auto prev = token;
     advance();
     return prev;
   }
   return std::nullopt;
 }
 
-Token Parser::advance() { return current_token_ = lexer_.next_token(); }
+void Parser::advance() {
+  peek(1);
+  if (current_ + 1 < tokens_.size()) {
+    ++current_;
+  }
+}
+
+const Token& Parser::peek(std::size_t offset) {
+  std::size_t index = current_ + offset;
+  while (index >= tokens_.size() && lexer_ &&
+         tokens_.back().get_type() != TOKEN_ETX) {
+    tokens_.push_back(lexer_->next_token());
+  }
+  return tokens_[std::min(index, tokens_.size() - 1)];
+}
 
 template <typename... TokenTypes>
 std::enable_if_t<(std::is_same_v<TokenTypes, TokenType> && ...), Token>
@@ -841,5 +856,5 @@ Parser::consume(const std::string& err_msg, TokenTypes... types) {
   if (auto token = match(types...)) {
     return *token;
   }
-  throw SyntaxError(current_token_, err_msg);
+  throw SyntaxError(peek(), err_msg);
 }
@@ -20,8 +20,9 @@
  * root.
  */
 class Parser {
-  ILexer& lexer_;
-  Token current_token_;
+  ILexer* lexer_; /**< Lexer pulled for further tokens, if not pre-lexed. */
+  std::vector<Token> tokens_; /**< Tokens read so far. */
+  std::size_t current_ = 0;   /**< Index of current token in tokens_. */
 
   using StmtHandlers =
       std::initializer_list<std::unique_ptr<Stmt> (Parser::*)()>;
@@ -32,6 +33,7 @@ class Parser {
   std::unique_ptr<Stmt> statement();
   std::unique_ptr<Stmt> if_stmt();
   std::unique_ptr<Stmt> while_stmt();
+  std::unique_ptr<Stmt> for_stmt();
   std::unique_ptr<Stmt> return_stmt();
   std::unique_ptr<Stmt> print_stmt();
   std::unique_ptr<Stmt> inspect_stmt();
@@ -45,10 +47,10 @@ class Parser {
 
   std::unique_ptr<Stmt> mut_var_decl();
   std::unique_ptr<Stmt> void_func_decl();
-  std::unique_ptr<Stmt> var_or_func_decl(const Token& type);
-  std::unique_ptr<VarDeclStmt> var_decl(const Token& type,
+  std::unique_ptr<Stmt> var_or_func_decl(const VarType& type);
+  std::unique_ptr<VarDeclStmt> var_decl(const VarType& type,
                                         const Token& identifier, bool mut);
-  std::unique_ptr<FuncStmt> func_decl(const Token& return_type,
+  std::unique_ptr<FuncStmt> func_decl(const VarType& return_type,
                                       const Token& identifier);
   std::optional<std::vector<std::unique_ptr<FuncParamStmt>>> func_params();
   std::unique_ptr<Stmt> assign_or_call(const Token& identifier);
@@ -56,25 +58,33 @@ class Parser {
   std::unique_ptr<CallStmt> call_stmt(const Token& identifier);
 
   std::unique_ptr<Expr> expression();
-  std::unique_ptr<Expr> logic_or();
-  std::unique_ptr<Expr> logic_and();
-  std::unique_ptr<Expr> equality();
-  std::unique_ptr<Expr> comparison();
-  std::unique_ptr<Expr> term();
-  std::unique_ptr<Expr> factor();
+  /**
+   * @brief Parses binary expression made of operators binding tighter than
+   * \p min_power, by precedence climbing over their binding powers.
+   */
+  std::unique_ptr<Expr> binary(unsigned int min_power);
   std::unique_ptr<Expr> unary();
   std::unique_ptr<Expr> type_cast();
   std::unique_ptr<Expr> call();
   std::unique_ptr<Expr> primary();
 
   std::optional<std::vector<std::unique_ptr<Expr>>> arguments();
-  std::unique_ptr<Expr> field_access(std::unique_ptr<Expr> parent_struct);
-  std::optional<Token> type();
+  std::unique_ptr<Expr> access(std::unique_ptr<Expr> parent);
+  std::optional<VarType> type();
+  VarType container_type(VarType element);
 
   template <typename... TokenTypes>
   opt_token_t match(TokenTypes&&... types);
 
-  Token advance();
+  void advance();
+
+  /**
+   * @brief Returns token \p offset positions after the current one.
+   *
+   * Pulls tokens from \ref Parser.lexer_ as needed. Offsets past the end of
+   * input yield the TOKEN_ETX token.
+   */
+  const Token& peek(std::size_t offset = 0);
 
   template <typename... TokenTypes>
   std::enable_if_t<(std::is_same_v<TokenTypes, TokenType> && ...), Token>
@@ -82,10 +92,25 @@ class Parser {
 
  public:
   explicit Parser(ILexer& lexer)
-      : lexer_(lexer), current_token_(lexer.next_token()){};
+      : lexer_(&lexer), tokens_{lexer.next_token()} {};
+
+  /**
+   * @brief Constructs parser consuming pre-lexed \p tokens, e.g. from
+   * Lexer::tokenize().
+   *
+   * @param tokens Tokens terminated with TOKEN_ETX.
+   */
+  explicit Parser(std::vector<Token> tokens)
+      : lexer_(nullptr), tokens_(std::move(tokens)) {
+    if (tokens_.empty() || tokens_.back().get_type() != TOKEN_ETX) {
+      tokens_.emplace_back(TOKEN_ETX, tokens_.empty()
+                                          ? Position{1, 0}
+                                          : tokens_.back().get_position());
+    }
+  };
 
   /**
-   * @brief Parses tokens from \refParser.lexer_ and produces AST.
+   * @brief Parses tokens and produces AST.
    *
    * @return Unique_ptr to Program statement (root of the AST).
    */
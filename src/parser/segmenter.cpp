@@ -0,0 +1,30 @@
+#include "segmenter.hpp"
+
+std::vector<std::size_t> find_statement_ends(const std::vector<Token>& tokens) {
+  std::vector<std::size_t> ends;
+  int depth = 0;
+  for (std::size_t i = 0; i + 1 < tokens.size(); ++i) {
+    TokenType type = tokens[i].get_type();
+    if (type == TOKEN_LBRACE) {
+      ++depth;
+      continue;
+    }
+    if (type == TOKEN_RBRACE) {
+      --depth;
+    }
+    if (depth < 0) {
+      break;
+    }
+    if (depth > 0 || (type != TOKEN_SEMICOLON && type != TOKEN_RBRACE)) {
+      continue;
+    }
+
+    TokenType next = tokens[i + 1].get_type();
+    if (next == TOKEN_ELSE ||
+        (type == TOKEN_RBRACE && next == TOKEN_SEMICOLON)) {
+      continue;
+    }
+    ends.push_back(i);
+  }
+  return ends;
+}
@@ -0,0 +1,24 @@
+/*! @file segmenter.hpp
+    @brief Top-level statement boundaries.
+*/
+
+#ifndef BOALANG_SEGMENTER_HPP
+#define BOALANG_SEGMENTER_HPP
+
+#include <vector>
+
+#include "token/token.hpp"
+
+/**
+ * @brief Finds top-level statements in \p tokens by brace matching.
+ *
+ * ';' or closing '}' at top level ends a statement unless followed by 'else',
+ * or by ';' in case of '}'. Scanning stops at unbalanced '}', leaving
+ * malformed input for the parser to report.
+ *
+ * @param tokens Tokens terminated with TOKEN_ETX.
+ * @return Indices of last tokens of top-level statements.
+ */
+std::vector<std::size_t> find_statement_ends(const std::vector<Token>& tokens);
+
+#endif  // BOALANG_SEGMENTER_HPP
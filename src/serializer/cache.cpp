@@ -0,0 +1,105 @@
+#include "cache.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "serializer.hpp"
+
+namespace {
+
+constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class MappedFile {
+  void* data_ = MAP_FAILED;
+  std::size_t size_ = 0;
+
+ public:
+  explicit MappedFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      size_ = static_cast<std::size_t>(st.st_size);
+      data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+  ~MappedFile() {
+    if (data_ != MAP_FAILED) {
+      munmap(data_, size_);
+    }
+  }
+
+  [[nodiscard]] bool valid() const { return data_ != MAP_FAILED; }
+  [[nodiscard]] std::string_view view() const {
+    return {static_cast<const char*>(data_), size_};
+  }
+};
+
+}  // namespace
+
+std::uint64_t hash_source(std::string_view source) {
+  std::uint64_t hash = FNV_OFFSET_BASIS;
+  for (char c : source) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+std::string cache_path(const std::string& source_path) {
+  return std::filesystem::path(source_path).replace_extension(".boac");
+}
+
+std::unique_ptr<Program> load_cached_program(const std::string& path,
+                                             std::uint64_t source_hash) {
+  MappedFile file(path);
+  if (!file.valid()) {
+    return nullptr;
+  }
+  try {
+    return ASTDeserializer::deserialize(file.view(), source_hash);
+  } catch (const SerializationError&) {
+    return nullptr;
+  }
+}
+
+bool store_cached_program(const std::string& path, const Program& program,
+                          std::uint64_t source_hash) {
+  std::string data = ASTSerializer::serialize(program, source_hash);
+  // unique among processes and threads storing the same program
+  std::string tmp_path =
+      path + ".tmp" + std::to_string(getpid()) + "-" +
+      std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  {
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(tmp_path, path, error);
+  if (error) {
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
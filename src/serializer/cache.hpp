@@ -0,0 +1,46 @@
+/*! @file cache.hpp
+    @brief On-disk cache of parsed programs.
+*/
+
+#ifndef BOALANG_CACHE_HPP
+#define BOALANG_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "stmt/stmt.hpp"
+
+/**
+ * @brief Computes 64-bit FNV-1a hash of \p source.
+ */
+std::uint64_t hash_source(std::string_view source);
+
+/**
+ * @brief Returns path of the cache file kept next to \p source_path.
+ */
+std::string cache_path(const std::string& source_path);
+
+/**
+ * @brief Loads program cached under \p path.
+ *
+ * The file is memory-mapped and deserialized without intermediate copies.
+ *
+ * @return Program or nullptr when the file is missing, stale or malformed.
+ */
+std::unique_ptr<Program> load_cached_program(const std::string& path,
+                                             std::uint64_t source_hash);
+
+/**
+ * @brief Serializes \p program and stores it under \p path.
+ *
+ * Data is written to a temporary file first and renamed, so concurrent
+ * readers never observe a partially written cache.
+ *
+ * @return True if the cache was written.
+ */
+bool store_cached_program(const std::string& path, const Program& program,
+                          std::uint64_t source_hash);
+
+#endif  // BOALANG_CACHE_HPP
@@ -0,0 +1,749 @@
+#include "serializer.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr std::string_view MAGIC = "BOAC"; /**< Serialized program prefix. */
+constexpr unsigned int VARINT_SHIFT = 7;
+constexpr std::uint8_t VARINT_MASK = 0x7F;
+constexpr std::uint8_t VARINT_CONTINUE = 0x80;
+constexpr unsigned int MAX_VARINT_SHIFT = 63;
+
+/**
+ * @brief Tags identifying serialized nodes.
+ */
+enum class NodeTag : std::uint8_t {
+  NONE = 0,
+  PROGRAM,
+  PRINT_STMT,
+  IF_STMT,
+  BLOCK_STMT,
+  WHILE_STMT,
+  FOR_STMT,
+  FOR_RANGE_STMT,
+  VAR_DECL_STMT,
+  STRUCT_FIELD_STMT,
+  STRUCT_DECL_STMT,
+  VARIANT_DECL_STMT,
+  ASSIGN_STMT,
+  CALL_STMT,
+  FUNC_PARAM_STMT,
+  FUNC_STMT,
+  RETURN_STMT,
+  LAMBDA_FUNC_STMT,
+  INSPECT_STMT,
+  ADDITION_EXPR,
+  SUBTRACTION_EXPR,
+  DIVISION_EXPR,
+  MULTIPLICATION_EXPR,
+  EQUAL_COMP_EXPR,
+  NOT_EQUAL_COMP_EXPR,
+  GREATER_COMP_EXPR,
+  GREATER_EQUAL_COMP_EXPR,
+  LESS_COMP_EXPR,
+  LESS_EQUAL_COMP_EXPR,
+  GROUPING_EXPR,
+  LITERAL_EXPR,
+  NEGATION_EXPR,
+  LOGICAL_NEGATION_EXPR,
+  VAR_EXPR,
+  LOGICAL_OR_EXPR,
+  LOGICAL_AND_EXPR,
+  IS_TYPE_EXPR,
+  AS_TYPE_EXPR,
+  INITALIZER_LIST_EXPR,
+  CALL_EXPR,
+  FIELD_ACCESS_EXPR,
+  INDEX_EXPR,
+};
+
+/**
+ * @brief Tags identifying serialized literal values.
+ */
+enum class ValueTag : std::uint8_t { NONE = 0, STR, INT, FLOAT, BOOL };
+
+}  // namespace
+
+std::string ASTSerializer::serialize(const Program& program,
+                                     std::uint64_t source_hash) {
+  ASTSerializer serializer;
+  serializer.buffer_.append(MAGIC);
+  serializer.write_uint(SERIALIZER_VERSION);
+  for (unsigned int i = 0; i < sizeof(source_hash); ++i) {
+    serializer.write_byte(static_cast<std::uint8_t>(source_hash >> (i * 8)));
+  }
+  program.accept(serializer);
+  return std::move(serializer.buffer_);
+}
+
+void ASTSerializer::write_byte(std::uint8_t byte) {
+  buffer_.push_back(static_cast<char>(byte));
+}
+
+void ASTSerializer::write_uint(std::uint64_t value) {
+  while (value >= VARINT_CONTINUE) {
+    write_byte(static_cast<std::uint8_t>(value) | VARINT_CONTINUE);
+    value >>= VARINT_SHIFT;
+  }
+  write_byte(static_cast<std::uint8_t>(value));
+}
+
+void ASTSerializer::write_int(std::int64_t value) {
+  // zigzag encoding keeps small negative numbers short
+  write_uint((static_cast<std::uint64_t>(value) << 1) ^
+             static_cast<std::uint64_t>(value >> MAX_VARINT_SHIFT));
+}
+
+void ASTSerializer::write_string(std::string_view value) {
+  write_uint(value.size());
+  buffer_.append(value);
+}
+
+void ASTSerializer::write_position(const Position& position) {
+  write_uint(position.line);
+  write_uint(position.column);
+}
+
+void ASTSerializer::write_var_type(const VarType& type) {
+  write_uint(type.type);
+  write_string(type.name);
+  if (type.type == MAP) {
+    write_var_type(*type.key);
+  }
+  if (type.type == ARRAY || type.type == MAP) {
+    write_var_type(*type.element);
+  }
+}
+
+void ASTSerializer::write_value(const value_t& value) {
+  std::visit(overloaded{
+                 [this](std::monostate) {
+                   write_byte(static_cast<std::uint8_t>(ValueTag::NONE));
+                 },
+                 [this](const std::string& arg) {
+                   write_byte(static_cast<std::uint8_t>(ValueTag::STR));
+                   write_string(arg);
+                 },
+                 [this](int arg) {
+                   write_byte(static_cast<std::uint8_t>(ValueTag::INT));
+                   write_int(arg);
+                 },
+                 [this](float arg) {
+                   write_byte(static_cast<std::uint8_t>(ValueTag::FLOAT));
+                   std::uint32_t bits = 0;
+                   std::memcpy(&bits, &arg, sizeof(bits));
+                   write_uint(bits);
+                 },
+                 [this](bool arg) {
+                   write_byte(static_cast<std::uint8_t>(ValueTag::BOOL));
+                   write_byte(arg ? 1 : 0);
+                 },
+             },
+             value);
+}
+
+void ASTSerializer::write_expr(const Expr* expr) {
+  if (!expr) {
+    write_byte(static_cast<std::uint8_t>(NodeTag::NONE));
+    return;
+  }
+  expr->accept(*this);
+}
+
+void ASTSerializer::write_stmt(const Stmt* stmt) {
+  if (!stmt) {
+    write_byte(static_cast<std::uint8_t>(NodeTag::NONE));
+    return;
+  }
+  stmt->accept(*this);
+}
+
+#define WRITE_HEADER(tag, node)                        \
+  write_byte(static_cast<std::uint8_t>(NodeTag::tag)); \
+  write_position((node).position)
+
+void ASTSerializer::visit(const Program& stmt) {
+  WRITE_HEADER(PROGRAM, stmt);
+  write_uint(stmt.statements.size());
+  for (const auto& s : stmt.statements) {
+    write_stmt(s.get());
+  }
+}
+
+void ASTSerializer::visit(const PrintStmt& stmt) {
+  WRITE_HEADER(PRINT_STMT, stmt);
+  write_expr(stmt.expr.get());
+}
+
+void ASTSerializer::visit(const IfStmt& stmt) {
+  WRITE_HEADER(IF_STMT, stmt);
+  write_expr(stmt.condition.get());
+  write_stmt(stmt.then_branch.get());
+  write_stmt(stmt.else_branch.get());
+}
+
+void ASTSerializer::visit(const BlockStmt& stmt) {
+  WRITE_HEADER(BLOCK_STMT, stmt);
+  write_uint(stmt.statements.size());
+  for (const auto& s : stmt.statements) {
+    write_stmt(s.get());
+  }
+}
+
+void ASTSerializer::visit(const WhileStmt& stmt) {
+  WRITE_HEADER(WHILE_STMT, stmt);
+  write_expr(stmt.condition.get());
+  write_stmt(stmt.body.get());
+}
+
+void ASTSerializer::visit(const ForStmt& stmt) {
+  WRITE_HEADER(FOR_STMT, stmt);
+  write_var_type(stmt.type);
+  write_string(stmt.identifier);
+  write_expr(stmt.iterable.get());
+  write_stmt(stmt.body.get());
+}
+
+void ASTSerializer::visit(const ForRangeStmt& stmt) {
+  WRITE_HEADER(FOR_RANGE_STMT, stmt);
+  write_string(stmt.identifier);
+  write_expr(stmt.begin.get());
+  write_expr(stmt.end.get());
+  write_stmt(stmt.body.get());
+}
+
+void ASTSerializer::visit(const VarDeclStmt& stmt) {
+  WRITE_HEADER(VAR_DECL_STMT, stmt);
+  write_var_type(stmt.type);
+  write_string(stmt.identifier);
+  write_expr(stmt.initializer.get());
+  write_byte(stmt.mut ? 1 : 0);
+}
+
+void ASTSerializer::visit(const StructFieldStmt& stmt) {
+  WRITE_HEADER(STRUCT_FIELD_STMT, stmt);
+  write_var_type(stmt.type);
+  write_string(stmt.identifier);
+  write_byte(stmt.mut ? 1 : 0);
+}
+
+void ASTSerializer::visit(const StructDeclStmt& stmt) {
+  WRITE_HEADER(STRUCT_DECL_STMT, stmt);
+  write_string(stmt.identifier);
+  write_uint(stmt.fields.size());
+  for (const auto& field : stmt.fields) {
+    write_stmt(field.get());
+  }
+}
+
+void ASTSerializer::visit(const VariantDeclStmt& stmt) {
+  WRITE_HEADER(VARIANT_DECL_STMT, stmt);
+  write_string(stmt.identifier);
+  write_uint(stmt.params.size());
+  for (const auto& param : stmt.params) {
+    write_var_type(param);
+  }
+}
+
+void ASTSerializer::visit(const AssignStmt& stmt) {
+  WRITE_HEADER(ASSIGN_STMT, stmt);
+  write_expr(stmt.var.get());
+  write_expr(stmt.value.get());
+}
+
+void ASTSerializer::visit(const CallStmt& stmt) {
+  WRITE_HEADER(CALL_STMT, stmt);
+  write_string(stmt.identifier);
+  write_uint(stmt.arguments.size());
+  for (const auto& arg : stmt.arguments) {
+    write_expr(arg.get());
+  }
+}
+
+void ASTSerializer::visit(const FuncParamStmt& stmt) {
+  WRITE_HEADER(FUNC_PARAM_STMT, stmt);
+  write_var_type(stmt.type);
+  write_string(stmt.identifier);
+}
+
+void ASTSerializer::visit(const FuncStmt& stmt) {
+  WRITE_HEADER(FUNC_STMT, stmt);
+  write_string(stmt.identifier);
+  write_var_type(stmt.return_type);
+  write_uint(stmt.params.size());
+  for (const auto& param : stmt.params) {
+    write_stmt(param.get());
+  }
+  write_stmt(stmt.body.get());
+}
+
+void ASTSerializer::visit(const ReturnStmt& stmt) {
+  WRITE_HEADER(RETURN_STMT, stmt);
+  write_expr(stmt.value.get());
+}
+
+void ASTSerializer::visit(const LambdaFuncStmt& stmt) {
+  WRITE_HEADER(LAMBDA_FUNC_STMT, stmt);
+  write_var_type(stmt.type);
+  write_string(stmt.identifier);
+  write_stmt(stmt.body.get());
+}
+
+void ASTSerializer::visit(const InspectStmt& stmt) {
+  WRITE_HEADER(INSPECT_STMT, stmt);
+  write_expr(stmt.inspected.get());
+  write_uint(stmt.lambdas.size());
+  for (const auto& lambda : stmt.lambdas) {
+    write_stmt(lambda.get());
+  }
+  write_stmt(stmt.default_lambda.get());
+}
+
+#define VISIT_BINARY(type, tag)                 \
+  void ASTSerializer::visit(const type& expr) { \
+    WRITE_HEADER(tag, expr);                    \
+    write_expr(expr.left.get());                \
+    write_expr(expr.right.get());               \
+  }
+
+VISIT_BINARY(AdditionExpr, ADDITION_EXPR)
+VISIT_BINARY(SubtractionExpr, SUBTRACTION_EXPR)
+VISIT_BINARY(DivisionExpr, DIVISION_EXPR)
+VISIT_BINARY(MultiplicationExpr, MULTIPLICATION_EXPR)
+VISIT_BINARY(EqualCompExpr, EQUAL_COMP_EXPR)
+VISIT_BINARY(NotEqualCompExpr, NOT_EQUAL_COMP_EXPR)
+VISIT_BINARY(GreaterCompExpr, GREATER_COMP_EXPR)
+VISIT_BINARY(GreaterEqualCompExpr, GREATER_EQUAL_COMP_EXPR)
+VISIT_BINARY(LessCompExpr, LESS_COMP_EXPR)
+VISIT_BINARY(LessEqualCompExpr, LESS_EQUAL_COMP_EXPR)
+VISIT_BINARY(LogicalOrExpr, LOGICAL_OR_EXPR)
+VISIT_BINARY(LogicalAndExpr, LOGICAL_AND_EXPR)
+
+void ASTSerializer::visit(const GroupingExpr& expr) {
+  WRITE_HEADER(GROUPING_EXPR, expr);
+  write_expr(expr.expr.get());
+}
+
+void ASTSerializer::visit(const LiteralExpr& expr) {
+  WRITE_HEADER(LITERAL_EXPR, expr);
+  write_value(expr.literal);
+}
+
+void ASTSerializer::visit(const NegationExpr& expr) {
+  WRITE_HEADER(NEGATION_EXPR, expr);
+  write_expr(expr.right.get());
+}
+
+void ASTSerializer::visit(const LogicalNegationExpr& expr) {
+  WRITE_HEADER(LOGICAL_NEGATION_EXPR, expr);
+  write_expr(expr.right.get());
+}
+
+void ASTSerializer::visit(const VarExpr& expr) {
+  WRITE_HEADER(VAR_EXPR, expr);
+  write_string(expr.identifier);
+}
+
+void ASTSerializer::visit(const IsTypeExpr& expr) {
+  WRITE_HEADER(IS_TYPE_EXPR, expr);
+  write_expr(expr.left.get());
+  write_var_type(expr.type);
+}
+
+void ASTSerializer::visit(const AsTypeExpr& expr) {
+  WRITE_HEADER(AS_TYPE_EXPR, expr);
+  write_expr(expr.left.get());
+  write_var_type(expr.type);
+}
+
+void ASTSerializer::visit(const InitalizerListExpr& expr) {
+  WRITE_HEADER(INITALIZER_LIST_EXPR, expr);
+  write_uint(expr.list.size());
+  for (const auto& item : expr.list) {
+    write_expr(item.get());
+  }
+}
+
+void ASTSerializer::visit(const CallExpr& expr) {
+  WRITE_HEADER(CALL_EXPR, expr);
+  write_string(expr.identifier);
+  write_uint(expr.arguments.size());
+  for (const auto& arg : expr.arguments) {
+    write_expr(arg.get());
+  }
+}
+
+void ASTSerializer::visit(const FieldAccessExpr& expr) {
+  WRITE_HEADER(FIELD_ACCESS_EXPR, expr);
+  write_expr(expr.parent_struct.get());
+  write_string(expr.field_name);
+}
+
+void ASTSerializer::visit(const IndexExpr& expr) {
+  WRITE_HEADER(INDEX_EXPR, expr);
+  write_expr(expr.array.get());
+  write_expr(expr.index.get());
+}
+
+#undef VISIT_BINARY
+#undef WRITE_HEADER
+
+std::unique_ptr<Program> ASTDeserializer::deserialize(
+    std::string_view data, std::uint64_t source_hash) {
+  if (!data.starts_with(MAGIC)) {
+    return nullptr;
+  }
+  ASTDeserializer deserializer(data.substr(MAGIC.size()));
+  if (deserializer.read_uint() != SERIALIZER_VERSION) {
+    return nullptr;
+  }
+  std::uint64_t hash = 0;
+  for (unsigned int i = 0; i < sizeof(hash); ++i) {
+    hash |= static_cast<std::uint64_t>(deserializer.read_byte()) << (i * 8);
+  }
+  if (hash != source_hash) {
+    return nullptr;
+  }
+
+  auto program = deserializer.read_node<Program>();
+  if (!deserializer.data_.empty()) {
+    throw SerializationError("unexpected data after program");
+  }
+  return program;
+}
+
+std::uint8_t ASTDeserializer::read_byte() {
+  if (data_.empty()) {
+    throw SerializationError("unexpected end of data");
+  }
+  auto byte = static_cast<std::uint8_t>(data_.front());
+  data_.remove_prefix(1);
+  return byte;
+}
+
+std::uint64_t ASTDeserializer::read_uint() {
+  std::uint64_t value = 0;
+  for (unsigned int shift = 0;; shift += VARINT_SHIFT) {
+    if (shift > MAX_VARINT_SHIFT) {
+      throw SerializationError("varint too long");
+    }
+    std::uint8_t byte = read_byte();
+    value |= static_cast<std::uint64_t>(byte & VARINT_MASK) << shift;
+    if (!(byte & VARINT_CONTINUE)) {
+      return value;
+    }
+  }
+}
+
+std::int64_t ASTDeserializer::read_int() {
+  std::uint64_t value = read_uint();
+  return static_cast<std::int64_t>(value >> 1) ^
+         -static_cast<std::int64_t>(value & 1);
+}
+
+std::string ASTDeserializer::read_string() {
+  auto size = read_uint();
+  if (size > data_.size()) {
+    throw SerializationError("string exceeds data");
+  }
+  std::string value(data_.substr(0, size));
+  data_.remove_prefix(size);
+  return value;
+}
+
+Position ASTDeserializer::read_position() {
+  auto line = static_cast<unsigned int>(read_uint());
+  auto column = static_cast<unsigned int>(read_uint());
+  return {line, column};
+}
+
+VarType ASTDeserializer::read_var_type() {
+  auto type = read_uint();
+  if (type > MAP) {
+    throw SerializationError("unknown type");
+  }
+  auto name = read_string();
+  if (type == ARRAY) {
+    return VarType::array_of(read_var_type());
+  }
+  if (type == MAP) {
+    auto key = read_var_type();
+    return VarType::map_of(std::move(key), read_var_type());
+  }
+  return {std::move(name), static_cast<BuiltinType>(type)};
+}
+
+value_t ASTDeserializer::read_value() {
+  switch (static_cast<ValueTag>(read_byte())) {
+    case ValueTag::NONE:
+      return std::monostate{};
+    case ValueTag::STR:
+      return read_string();
+    case ValueTag::INT:
+      return static_cast<int>(read_int());
+    case ValueTag::FLOAT: {
+      auto bits = static_cast<std::uint32_t>(read_uint());
+      float value = 0;
+      std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+    case ValueTag::BOOL:
+      return read_byte() != 0;
+    default:
+      throw SerializationError("unknown value tag");
+  }
+}
+
+std::vector<std::unique_ptr<Expr>> ASTDeserializer::read_exprs() {
+  auto size = read_uint();
+  std::vector<std::unique_ptr<Expr>> exprs;
+  for (std::uint64_t i = 0; i < size; ++i) {
+    exprs.push_back(read_expr());
+  }
+  return exprs;
+}
+
+std::vector<std::unique_ptr<Stmt>> ASTDeserializer::read_stmts() {
+  auto size = read_uint();
+  std::vector<std::unique_ptr<Stmt>> stmts;
+  for (std::uint64_t i = 0; i < size; ++i) {
+    stmts.push_back(read_stmt());
+  }
+  return stmts;
+}
+
+template <typename T>
+std::unique_ptr<T> ASTDeserializer::read_node() {
+  std::unique_ptr<Stmt> stmt = read_stmt();
+  if (auto* node = dynamic_cast<T*>(stmt.get())) {
+    stmt.release();
+    return std::unique_ptr<T>(node);
+  }
+  throw SerializationError("unexpected statement type");
+}
+
+template <typename T>
+std::unique_ptr<T> ASTDeserializer::read_binary(Position position) {
+  auto left = read_expr();
+  auto right = read_expr();
+  return std::make_unique<T>(std::move(left), std::move(right), position);
+}
+
+bool ASTDeserializer::read_none() {
+  if (!data_.empty() && static_cast<NodeTag>(data_.front()) == NodeTag::NONE) {
+    data_.remove_prefix(1);
+    return true;
+  }
+  return false;
+}
+
+std::unique_ptr<Expr> ASTDeserializer::read_optional_expr() {
+  return read_none() ? nullptr : read_expr();
+}
+
+std::unique_ptr<Stmt> ASTDeserializer::read_optional_stmt() {
+  return read_none() ? nullptr : read_stmt();
+}
+
+std::unique_ptr<Expr> ASTDeserializer::read_expr() {
+  auto tag = static_cast<NodeTag>(read_byte());
+  if (tag == NodeTag::NONE) {
+    throw SerializationError("missing expression");
+  }
+  Position position = read_position();
+  switch (tag) {
+    case NodeTag::ADDITION_EXPR:
+      return read_binary<AdditionExpr>(position);
+    case NodeTag::SUBTRACTION_EXPR:
+      return read_binary<SubtractionExpr>(position);
+    case NodeTag::DIVISION_EXPR:
+      return read_binary<DivisionExpr>(position);
+    case NodeTag::MULTIPLICATION_EXPR:
+      return read_binary<MultiplicationExpr>(position);
+    case NodeTag::EQUAL_COMP_EXPR:
+      return read_binary<EqualCompExpr>(position);
+    case NodeTag::NOT_EQUAL_COMP_EXPR:
+      return read_binary<NotEqualCompExpr>(position);
+    case NodeTag::GREATER_COMP_EXPR:
+      return read_binary<GreaterCompExpr>(position);
+    case NodeTag::GREATER_EQUAL_COMP_EXPR:
+      return read_binary<GreaterEqualCompExpr>(position);
+    case NodeTag::LESS_COMP_EXPR:
+      return read_binary<LessCompExpr>(position);
+    case NodeTag::LESS_EQUAL_COMP_EXPR:
+      return read_binary<LessEqualCompExpr>(position);
+    case NodeTag::LOGICAL_OR_EXPR:
+      return read_binary<LogicalOrExpr>(position);
+    case NodeTag::LOGICAL_AND_EXPR:
+      return read_binary<LogicalAndExpr>(position);
+    case NodeTag::GROUPING_EXPR:
+      return std::make_unique<GroupingExpr>(read_expr(), position);
+    case NodeTag::LITERAL_EXPR:
+      return std::make_unique<LiteralExpr>(read_value(), position);
+    case NodeTag::NEGATION_EXPR:
+      return std::make_unique<NegationExpr>(read_expr(), position);
+    case NodeTag::LOGICAL_NEGATION_EXPR:
+      return std::make_unique<LogicalNegationExpr>(read_expr(), position);
+    case NodeTag::VAR_EXPR:
+      return std::make_unique<VarExpr>(read_string(), position);
+    case NodeTag::IS_TYPE_EXPR: {
+      auto left = read_expr();
+      return std::make_unique<IsTypeExpr>(std::move(left), read_var_type(),
+                                          position);
+    }
+    case NodeTag::AS_TYPE_EXPR: {
+      auto left = read_expr();
+      return std::make_unique<AsTypeExpr>(std::move(left), read_var_type(),
+                                          position);
+    }
+    case NodeTag::INITALIZER_LIST_EXPR:
+      return std::make_unique<InitalizerListExpr>(read_exprs(), position);
+    case NodeTag::CALL_EXPR: {
+      auto identifier = read_string();
+      return std::make_unique<CallExpr>(std::move(identifier), position,
+                                        read_exprs());
+    }
+    case NodeTag::FIELD_ACCESS_EXPR: {
+      auto parent = read_expr();
+      return std::make_unique<FieldAccessExpr>(std::move(parent), read_string(),
+                                               position);
+    }
+    case NodeTag::INDEX_EXPR: {
+      auto array = read_expr();
+      return std::make_unique<IndexExpr>(std::move(array), read_expr(),
+                                         position);
+    }
+    default:
+      throw SerializationError("unexpected expression tag");
+  }
+}
+
+std::unique_ptr<Stmt> ASTDeserializer::read_stmt() {
+  auto tag = static_cast<NodeTag>(read_byte());
+  if (tag == NodeTag::NONE) {
+    throw SerializationError("missing statement");
+  }
+  Position position = read_position();
+  switch (tag) {
+    case NodeTag::PROGRAM:
+      return std::make_unique<Program>(read_stmts(), position);
+    case NodeTag::PRINT_STMT:
+      return std::make_unique<PrintStmt>(read_expr(), position);
+    case NodeTag::IF_STMT: {
+      auto condition = read_expr();
+      auto then_branch = read_stmt();
+      auto else_branch = read_optional_stmt();
+      return std::make_unique<IfStmt>(std::move(condition),
+                                      std::move(then_branch),
+                                      std::move(else_branch), position);
+    }
+    case NodeTag::BLOCK_STMT:
+      return std::make_unique<BlockStmt>(read_stmts(), position);
+    case NodeTag::WHILE_STMT: {
+      auto condition = read_expr();
+      return std::make_unique<WhileStmt>(std::move(condition), read_stmt(),
+                                         position);
+    }
+    case NodeTag::FOR_STMT: {
+      auto type = read_var_type();
+      auto identifier = read_string();
+      auto iterable = read_expr();
+      return std::make_unique<ForStmt>(std::move(type), std::move(identifier),
+                                       std::move(iterable), read_stmt(),
+                                       position);
+    }
+    case NodeTag::FOR_RANGE_STMT: {
+      auto identifier = read_string();
+      auto begin = read_expr();
+      auto end = read_expr();
+      return std::make_unique<ForRangeStmt>(std::move(identifier),
+                                            std::move(begin), std::move(end),
+                                            read_stmt(), position);
+    }
+    case NodeTag::VAR_DECL_STMT: {
+      auto type = read_var_type();
+      auto identifier = read_string();
+      auto initializer = read_optional_expr();
+      bool mut = read_byte() != 0;
+      return std::make_unique<VarDeclStmt>(
+          std::move(type), std::move(identifier), std::move(initializer),
+          position, mut);
+    }
+    case NodeTag::STRUCT_FIELD_STMT: {
+      auto type = read_var_type();
+      auto identifier = read_string();
+      bool mut = read_byte() != 0;
+      return std::make_unique<StructFieldStmt>(
+          std::move(type), std::move(identifier), position, mut);
+    }
+    case NodeTag::STRUCT_DECL_STMT: {
+      auto identifier = read_string();
+      auto size = read_uint();
+      std::vector<std::unique_ptr<StructFieldStmt>> fields;
+      for (std::uint64_t i = 0; i < size; ++i) {
+        fields.push_back(read_node<StructFieldStmt>());
+      }
+      return std::make_unique<StructDeclStmt>(std::move(identifier),
+                                              std::move(fields), position);
+    }
+    case NodeTag::VARIANT_DECL_STMT: {
+      auto identifier = read_string();
+      auto size = read_uint();
+      std::vector<VarType> params;
+      for (std::uint64_t i = 0; i < size; ++i) {
+        params.push_back(read_var_type());
+      }
+      return std::make_unique<VariantDeclStmt>(std::move(identifier),
+                                               std::move(params), position);
+    }
+    case NodeTag::ASSIGN_STMT: {
+      auto var = read_expr();
+      return std::make_unique<AssignStmt>(std::move(var), read_expr(),
+                                          position);
+    }
+    case NodeTag::CALL_STMT: {
+      auto identifier = read_string();
+      return std::make_unique<CallStmt>(std::move(identifier), position,
+                                        read_exprs());
+    }
+    case NodeTag::FUNC_PARAM_STMT: {
+      auto type = read_var_type();
+      return std::make_unique<FuncParamStmt>(std::move(type), read_string(),
+                                             position);
+    }
+    case NodeTag::FUNC_STMT: {
+      auto identifier = read_string();
+      auto return_type = read_var_type();
+      auto size = read_uint();
+      std::vector<std::unique_ptr<FuncParamStmt>> params;
+      for (std::uint64_t i = 0; i < size; ++i) {
+        params.push_back(read_node<FuncParamStmt>());
+      }
+      return std::make_unique<FuncStmt>(
+          std::move(identifier), std::move(return_type), std::move(params),
+          read_stmt(), position);
+    }
+    case NodeTag::RETURN_STMT:
+      return std::make_unique<ReturnStmt>(read_optional_expr(), position);
+    case NodeTag::LAMBDA_FUNC_STMT: {
+      auto type = read_var_type();
+      auto identifier = read_string();
+      return std::make_unique<LambdaFuncStmt>(
+          std::move(type), std::move(identifier), read_stmt(), position);
+    }
+    case NodeTag::INSPECT_STMT: {
+      auto inspected = read_expr();
+      auto size = read_uint();
+      std::vector<std::unique_ptr<LambdaFuncStmt>> lambdas;
+      for (std::uint64_t i = 0; i < size; ++i) {
+        lambdas.push_back(read_node<LambdaFuncStmt>());
+      }
+      return std::make_unique<InspectStmt>(std::move(inspected),
+                                           std::move(lambdas), position,
+                                           read_optional_stmt());
+    }
+    default:
+      throw SerializationError("unexpected statement tag");
+  }
+}
@@ -0,0 +1,141 @@
+/*! @file serializer.hpp
+    @brief Binary AST serialization.
+*/
+
+#ifndef BOALANG_SERIALIZER_HPP
+#define BOALANG_SERIALIZER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "expr/expr.hpp"
+#include "stmt/stmt.hpp"
+
+constexpr std::uint32_t SERIALIZER_VERSION =
+    4; /**< Bumped whenever the binary AST layout changes. */
+
+/**
+ * @brief Represents malformed serialized AST data.
+ */
+class SerializationError : public std::runtime_error {
+ public:
+  explicit SerializationError(const std::string& message)
+      : std::runtime_error("Malformed serialized program: " + message){};
+};
+
+/**
+ * @brief Serializes AST into a compact binary form.
+ *
+ * The output starts with a header holding magic bytes, \ref
+ * SERIALIZER_VERSION and a hash of the source the program was parsed from,
+ * followed by the nodes in pre-order.
+ */
+class ASTSerializer : public ExprVisitor, public StmtVisitor {
+  std::string buffer_; /**< Serialized bytes. */
+
+  void write_byte(std::uint8_t byte);
+  void write_uint(std::uint64_t value);
+  void write_int(std::int64_t value);
+  void write_string(std::string_view value);
+  void write_position(const Position& position);
+  void write_var_type(const VarType& type);
+  void write_value(const value_t& value);
+  void write_expr(const Expr* expr);
+  void write_stmt(const Stmt* stmt);
+
+ public:
+  /**
+   * @brief Serializes \p program parsed from source with \p source_hash.
+   */
+  static std::string serialize(const Program& program,
+                               std::uint64_t source_hash);
+
+  void visit(const Program& stmt) override;
+  void visit(const PrintStmt& stmt) override;
+  void visit(const IfStmt& stmt) override;
+  void visit(const BlockStmt& stmt) override;
+  void visit(const WhileStmt& stmt) override;
+  void visit(const ForStmt& stmt) override;
+  void visit(const ForRangeStmt& stmt) override;
+  void visit(const VarDeclStmt& stmt) override;
+  void visit(const StructFieldStmt& stmt) override;
+  void visit(const StructDeclStmt& stmt) override;
+  void visit(const VariantDeclStmt& stmt) override;
+  void visit(const AssignStmt& stmt) override;
+  void visit(const CallStmt& stmt) override;
+  void visit(const FuncParamStmt& stmt) override;
+  void visit(const FuncStmt& stmt) override;
+  void visit(const ReturnStmt& stmt) override;
+  void visit(const LambdaFuncStmt& stmt) override;
+  void visit(const InspectStmt& stmt) override;
+
+  void visit(const AdditionExpr& expr) override;
+  void visit(const SubtractionExpr& expr) override;
+  void visit(const DivisionExpr& expr) override;
+  void visit(const MultiplicationExpr& expr) override;
+  void visit(const EqualCompExpr& expr) override;
+  void visit(const NotEqualCompExpr& expr) override;
+  void visit(const GreaterCompExpr& expr) override;
+  void visit(const GreaterEqualCompExpr& expr) override;
+  void visit(const LessCompExpr& expr) override;
+  void visit(const LessEqualCompExpr& expr) override;
+  void visit(const GroupingExpr& expr) override;
+  void visit(const LiteralExpr& expr) override;
+  void visit(const NegationExpr& expr) override;
+  void visit(const LogicalNegationExpr& expr) override;
+  void visit(const VarExpr& expr) override;
+  void visit(const LogicalOrExpr& expr) override;
+  void visit(const LogicalAndExpr& expr) override;
+  void visit(const IsTypeExpr& expr) override;
+  void visit(const AsTypeExpr& expr) override;
+  void visit(const InitalizerListExpr& expr) override;
+  void visit(const CallExpr& expr) override;
+  void visit(const FieldAccessExpr& expr) override;
+  void visit(const IndexExpr& expr) override;
+};
+
+/**
+ * @brief Rebuilds AST from data produced by \ref ASTSerializer.
+ */
+class ASTDeserializer {
+  std::string_view data_; /**< Remaining serialized bytes. */
+
+  explicit ASTDeserializer(std::string_view data) : data_(data){};
+
+  std::uint8_t read_byte();
+  std::uint64_t read_uint();
+  std::int64_t read_int();
+  std::string read_string();
+  Position read_position();
+  VarType read_var_type();
+  value_t read_value();
+  std::unique_ptr<Expr> read_expr();
+  std::unique_ptr<Stmt> read_stmt();
+  bool read_none();
+  std::unique_ptr<Expr> read_optional_expr();
+  std::unique_ptr<Stmt> read_optional_stmt();
+  std::vector<std::unique_ptr<Expr>> read_exprs();
+  std::vector<std::unique_ptr<Stmt>> read_stmts();
+
+  template <typename T>
+  std::unique_ptr<T> read_node();
+
+  template <typename T>
+  std::unique_ptr<T> read_binary(Position position);
+
+ public:
+  /**
+   * @brief Deserializes program from \p data.
+   *
+   * @return Program or nullptr when the header does not match current \ref
+   * SERIALIZER_VERSION or \p source_hash.
+   * @throws SerializationError when \p data is malformed.
+   */
+  static std::unique_ptr<Program> deserialize(std::string_view data,
+                                              std::uint64_t source_hash);
+};
+
+#endif  // BOALANG_SERIALIZER_HPP
@@ -0,0 +1,231 @@
+#include "scan.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BOALANG_SCAN_X86
+#endif
+
+namespace {
+
+constexpr char FIRST_CONTROL_SPACE = '\t'; /**< \t \n \v \f \r are adjacent. */
+constexpr char CONTROL_SPACE_RANGE = '\r' - '\t';
+
+bool is_space(char c) {
+  return c == ' ' || static_cast<unsigned char>(c - FIRST_CONTROL_SPACE) <=
+                         CONTROL_SPACE_RANGE;
+}
+
+std::size_t scalar_find_non_whitespace(std::string_view text) {
+  return static_cast<std::size_t>(
+      std::find_if_not(text.begin(), text.end(), is_space) - text.begin());
+}
+
+std::size_t scalar_find_char(std::string_view text, char c) {
+  return std::min(text.find(c), text.size());
+}
+
+std::size_t scalar_find_either(std::string_view text, char a, char b) {
+  return static_cast<std::size_t>(
+      std::find_if(text.begin(), text.end(),
+                   [a, b](char c) { return c == a || c == b; }) -
+      text.begin());
+}
+
+std::size_t scalar_count_char(std::string_view text, char c) {
+  return static_cast<std::size_t>(std::count(text.begin(), text.end(), c));
+}
+
+#ifdef BOALANG_SCAN_X86
+
+constexpr std::size_t SSE2_WIDTH = sizeof(__m128i);
+constexpr std::size_t AVX2_WIDTH = sizeof(__m256i);
+constexpr std::uint32_t SSE2_FULL_MASK = 0xFFFF;
+
+__m128i sse2_load(std::string_view text, std::size_t i) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(&text[i]));
+}
+
+/**
+ * @brief Returns mask of isspace characters in \p chunk.
+ */
+std::uint32_t sse2_space_mask(__m128i chunk) {
+  __m128i shifted = _mm_sub_epi8(chunk, _mm_set1_epi8(FIRST_CONTROL_SPACE));
+  __m128i control = _mm_cmpeq_epi8(
+      _mm_min_epu8(shifted, _mm_set1_epi8(CONTROL_SPACE_RANGE)), shifted);
+  __m128i space = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '));
+  return static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_or_si128(space, control)));
+}
+
+std::size_t sse2_find_non_whitespace(std::string_view text) {
+  std::size_t i = 0;
+  for (; i + SSE2_WIDTH <= text.size(); i += SSE2_WIDTH) {
+    if (auto bits = ~sse2_space_mask(sse2_load(text, i)) & SSE2_FULL_MASK) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + scalar_find_non_whitespace(text.substr(i));
+}
+
+std::size_t sse2_find_char(std::string_view text, char c) {
+  const __m128i needle = _mm_set1_epi8(c);
+  std::size_t i = 0;
+  for (; i + SSE2_WIDTH <= text.size(); i += SSE2_WIDTH) {
+    if (auto bits = static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(sse2_load(text, i), needle)))) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + scalar_find_char(text.substr(i), c);
+}
+
+std::size_t sse2_find_either(std::string_view text, char a, char b) {
+  const __m128i needle_a = _mm_set1_epi8(a);
+  const __m128i needle_b = _mm_set1_epi8(b);
+  std::size_t i = 0;
+  for (; i + SSE2_WIDTH <= text.size(); i += SSE2_WIDTH) {
+    __m128i chunk = sse2_load(text, i);
+    if (auto bits = static_cast<std::uint32_t>(
+            _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, needle_a),
+                                           _mm_cmpeq_epi8(chunk, needle_b))))) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + scalar_find_either(text.substr(i), a, b);
+}
+
+std::size_t sse2_count_char(std::string_view text, char c) {
+  const __m128i needle = _mm_set1_epi8(c);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + SSE2_WIDTH <= text.size(); i += SSE2_WIDTH) {
+    count += static_cast<std::size_t>(std::popcount(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(sse2_load(text, i), needle)))));
+  }
+  return count + scalar_count_char(text.substr(i), c);
+}
+
+#define BOALANG_AVX2 __attribute__((target("avx2")))
+
+BOALANG_AVX2 __m256i avx2_load(std::string_view text, std::size_t i) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&text[i]));
+}
+
+BOALANG_AVX2 std::size_t avx2_find_non_whitespace(std::string_view text) {
+  const __m256i first = _mm256_set1_epi8(FIRST_CONTROL_SPACE);
+  const __m256i range = _mm256_set1_epi8(CONTROL_SPACE_RANGE);
+  const __m256i space = _mm256_set1_epi8(' ');
+  std::size_t i = 0;
+  for (; i + AVX2_WIDTH <= text.size(); i += AVX2_WIDTH) {
+    __m256i chunk = avx2_load(text, i);
+    __m256i shifted = _mm256_sub_epi8(chunk, first);
+    __m256i control =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, range), shifted);
+    __m256i ws = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, space), control);
+    if (auto bits = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(ws))) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + sse2_find_non_whitespace(text.substr(i));
+}
+
+BOALANG_AVX2 std::size_t avx2_find_char(std::string_view text, char c) {
+  const __m256i needle = _mm256_set1_epi8(c);
+  std::size_t i = 0;
+  for (; i + AVX2_WIDTH <= text.size(); i += AVX2_WIDTH) {
+    if (auto bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(avx2_load(text, i), needle)))) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + sse2_find_char(text.substr(i), c);
+}
+
+BOALANG_AVX2 std::size_t avx2_find_either(std::string_view text, char a,
+                                          char b) {
+  const __m256i needle_a = _mm256_set1_epi8(a);
+  const __m256i needle_b = _mm256_set1_epi8(b);
+  std::size_t i = 0;
+  for (; i + AVX2_WIDTH <= text.size(); i += AVX2_WIDTH) {
+    __m256i chunk = avx2_load(text, i);
+    if (auto bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, needle_a),
+                            _mm256_cmpeq_epi8(chunk, needle_b))))) {
+      return i + static_cast<std::size_t>(std::countr_zero(bits));
+    }
+  }
+  return i + sse2_find_either(text.substr(i), a, b);
+}
+
+BOALANG_AVX2 std::size_t avx2_count_char(std::string_view text, char c) {
+  const __m256i needle = _mm256_set1_epi8(c);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + AVX2_WIDTH <= text.size(); i += AVX2_WIDTH) {
+    count += static_cast<std::size_t>(std::popcount(static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(avx2_load(text, i), needle)))));
+  }
+  return count + sse2_count_char(text.substr(i), c);
+}
+
+#undef BOALANG_AVX2
+
+constexpr ScanKernels sse2_kernels = {
+    sse2_find_non_whitespace,
+    sse2_find_char,
+    sse2_find_either,
+    sse2_count_char,
+};
+
+constexpr ScanKernels avx2_kernels = {
+    avx2_find_non_whitespace,
+    avx2_find_char,
+    avx2_find_either,
+    avx2_count_char,
+};
+
+#endif  // BOALANG_SCAN_X86
+
+constexpr ScanKernels scalar_kernels = {
+    scalar_find_non_whitespace,
+    scalar_find_char,
+    scalar_find_either,
+    scalar_count_char,
+};
+
+}  // namespace
+
+ScanLevel supported_scan_level() {
+#ifdef BOALANG_SCAN_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return ScanLevel::AVX2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return ScanLevel::SSE2;
+  }
+#endif
+  return ScanLevel::SCALAR;
+}
+
+const ScanKernels& scan_kernels(ScanLevel level) {
+  level = std::min(level, supported_scan_level());
+#ifdef BOALANG_SCAN_X86
+  if (level == ScanLevel::AVX2) {
+    return avx2_kernels;
+  }
+  if (level == ScanLevel::SSE2) {
+    return sse2_kernels;
+  }
+#endif
+  return scalar_kernels;
+}
+
+const ScanKernels& scan_kernels() {
+  static const ScanKernels& kernels = scan_kernels(supported_scan_level());
+  return kernels;
+}
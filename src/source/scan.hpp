@@ -0,0 +1,49 @@
+/*! @file scan.hpp
+    @brief Vectorized character scanning kernels.
+*/
+
+#ifndef BOALANG_SCAN_HPP
+#define BOALANG_SCAN_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Instruction set used by scanning kernels.
+ */
+enum class ScanLevel { SCALAR, SSE2, AVX2 };
+
+/**
+ * @brief Set of scanning kernels for one \ref ScanLevel.
+ *
+ * Each search kernel returns index of the first matching character or size
+ * of the scanned text if there is none.
+ */
+struct ScanKernels {
+  std::size_t (*find_non_whitespace)(
+      std::string_view text); /**< Finds first char not matching isspace. */
+  std::size_t (*find_char)(std::string_view text,
+                           char c); /**< Finds first \p c. */
+  std::size_t (*find_either)(std::string_view text, char a,
+                             char b); /**< Finds first \p a or \p b. */
+  std::size_t (*count_char)(std::string_view text,
+                            char c); /**< Counts occurrences of \p c. */
+};
+
+/**
+ * @brief Returns the best \ref ScanLevel supported by the running CPU.
+ */
+ScanLevel supported_scan_level();
+
+/**
+ * @brief Returns kernels for \p level, or for the best supported level below
+ * it.
+ */
+const ScanKernels& scan_kernels(ScanLevel level);
+
+/**
+ * @brief Returns kernels for \ref supported_scan_level(), selected once.
+ */
+const ScanKernels& scan_kernels();
+
+#endif  // BOALANG_SCAN_HPP
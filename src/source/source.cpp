@@ -1,35 +1,83 @@
 #include "source.hpp"
 
-char Source::next() {
-  auto prev = current_;
-  stream_->get(current_);
+#include <iterator>
 
-  if (stream_->eof()) {
-    current_ = '\0';
-    return current_;
+#include "scan.hpp"
+
+Source::Source(stream_ptr stream)
+    : Source(std::string(std::istreambuf_iterator<char>(*stream),
+                         std::istreambuf_iterator<char>())) {}
+
+Source::Source(std::string text, Position start)
+    : position_(start), buffer_(std::move(text)) {
+  // nothing past a null character is ever read
+  if (std::size_t null = buffer_.find('\0'); null != std::string::npos) {
+    buffer_.resize(null);
   }
 
-  if (current_ == '\r' && stream_->peek() == '\n') {
-    stream_->ignore();
-    current_ = '\n';
+  std::size_t crlf = buffer_.find("\r\n");
+  if (crlf == std::string::npos) {
+    return;
   }
+  std::size_t out = crlf;
+  for (std::size_t in = crlf; in < buffer_.size(); ++in) {
+    if (buffer_[in] == '\r' && in + 1 < buffer_.size() &&
+        buffer_[in + 1] == '\n') {
+      continue;
+    }
+    buffer_[out++] = buffer_[in];
+  }
+  buffer_.resize(out);
+}
 
-  if (prev == '\n') {
+char Source::next() {
+  if (offset_ >= buffer_.size()) {
+    current_ = '\0';
+    return current_;
+  }
+
+  if (current_ == '\n') {
     ++position_.line;
     position_.column = 1;
   } else {
     ++position_.column;
   }
 
+  current_ = buffer_[offset_++];
   return current_;
 }
 
+void Source::skip(std::size_t count) {
+  if (count == 0) {
+    return;
+  }
+  std::string_view span = remaining().substr(0, count);
+  // position of the last char depends on newlines preceding it
+  std::string_view preceding = span.substr(0, span.size() - 1);
+  std::size_t newlines = scan_kernels().count_char(preceding, '\n');
+  if (newlines > 0) {
+    position_.line += static_cast<unsigned int>(newlines);
+    position_.column =
+        static_cast<unsigned int>(preceding.size() - preceding.rfind('\n'));
+    if (current_ == '\n') {
+      ++position_.line;
+    }
+  } else if (current_ == '\n') {
+    ++position_.line;
+    position_.column = static_cast<unsigned int>(span.size());
+  } else {
+    position_.column += static_cast<unsigned int>(span.size());
+  }
+
+  current_ = span.back();
+  offset_ += span.size();
+}
+
 char Source::peek() const {
-  std::wistream::int_type c = stream_->peek();
-  if (c == std::wistream::traits_type::eof()) {
+  if (offset_ >= buffer_.size()) {
     return '\0';
   }
-  return static_cast<char>(c);
+  return buffer_[offset_];
 }
 
 char Source::current() const { return current_; }
@@ -9,6 +9,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 #include "utils/position.hpp"
 
@@ -18,18 +19,29 @@ using stream_ptr =
 /**
  * @brief The Source class represents a source of characters, such as a file or
  * a string.
+ *
+ * The whole input is buffered up front with CRLF line endings normalized, so
+ * the lexer can scan spans of it at once.
  */
 class Source {
   Position position_ = {1, 0}; /**< Current position within the source. */
   char current_ = '\0';        /**< Current character being processed. */
-  stream_ptr stream_;          /**< Pointer to the input stream. */
+  std::string buffer_;         /**< Normalized source text. */
+  std::size_t offset_ = 0;     /**< Offset of the next character. */
 
  public:
   /**
    * @brief Constructs a Source object with the given input stream.
    * @param stream The input stream.
    */
-  explicit Source(stream_ptr stream) : stream_(std::move(stream)) {}
+  explicit Source(stream_ptr stream);
+
+  /**
+   * @brief Constructs a Source object with the given text.
+   * @param text The source text.
+   * @param start Position preceding the first character.
+   */
+  explicit Source(std::string text, Position start = {1, 0});
   Source(const Source&) = delete;
   Source& operator=(const Source&) = delete;
   Source(Source&&) = delete;
@@ -62,6 +74,20 @@ class Source {
    * @return True if the end of the source has been reached, false otherwise.
    */
   [[nodiscard]] bool eof() const;
+
+  /**
+   * @brief Returns characters that were not retrieved yet.
+   */
+  [[nodiscard]] std::string_view remaining() const {
+    return std::string_view(buffer_).substr(offset_);
+  }
+
+  /**
+   * @brief Retrieves \p count next characters at once, as if by calling
+   * next() \p count times.
+   * @param count Number of characters, at most remaining().size().
+   */
+  void skip(std::size_t count);
 };
 
 /**
@@ -86,9 +112,11 @@ class StringSource : public Source {
   /**
    * @brief Constructs a StringSource object with the given string.
    * @param source The source string.
+   * @param start Position preceding the first character, when \p source is
+   * a fragment of a larger text.
    */
-  explicit StringSource(const std::string& source)
-      : Source(std::make_unique<std::istringstream>(source)){};
+  explicit StringSource(const std::string& source, Position start = {1, 0})
+      : Source(source, start){};
 };
 
 #endif  // BOALANG_SOURCE_HPP
@@ -15,6 +15,8 @@ class PrintStmt;
 class IfStmt;
 class BlockStmt;
 class WhileStmt;
+class ForStmt;
+class ForRangeStmt;
 class VarDeclStmt;
 class StructFieldStmt;
 class StructDeclStmt;
@@ -46,6 +48,8 @@ class StmtVisitor {
   virtual void visit(const IfStmt& stmt) = 0;
   virtual void visit(const BlockStmt& stmt) = 0;
   virtual void visit(const WhileStmt& stmt) = 0;
+  virtual void visit(const ForStmt& stmt) = 0;
+  virtual void visit(const ForRangeStmt& stmt) = 0;
   virtual void visit(const VarDeclStmt& stmt) = 0;
   virtual void visit(const StructFieldStmt& stmt) = 0;
   virtual void visit(const StructDeclStmt& stmt) = 0;
@@ -59,6 +63,40 @@ class StmtVisitor {
   virtual void visit(const InspectStmt& stmt) = 0;
 };
 
+/**
+ * @brief Interface for statements visitor that may modify visited nodes.
+ */
+class MutableStmtVisitor {
+ public:
+  virtual ~MutableStmtVisitor() = default;
+
+  MutableStmtVisitor() = default;
+  MutableStmtVisitor(const MutableStmtVisitor&) = delete;
+  MutableStmtVisitor& operator=(const MutableStmtVisitor&) = delete;
+
+  MutableStmtVisitor(MutableStmtVisitor&&) = default;
+  MutableStmtVisitor& operator=(MutableStmtVisitor&&) = default;
+
+  virtual void visit(Program& stmt) = 0;
+  virtual void visit(PrintStmt& stmt) = 0;
+  virtual void visit(IfStmt& stmt) = 0;
+  virtual void visit(BlockStmt& stmt) = 0;
+  virtual void visit(WhileStmt& stmt) = 0;
+  virtual void visit(ForStmt& stmt) = 0;
+  virtual void visit(ForRangeStmt& stmt) = 0;
+  virtual void visit(VarDeclStmt& stmt) = 0;
+  virtual void visit(StructFieldStmt& stmt) = 0;
+  virtual void visit(StructDeclStmt& stmt) = 0;
+  virtual void visit(VariantDeclStmt& stmt) = 0;
+  virtual void visit(AssignStmt& stmt) = 0;
+  virtual void visit(CallStmt& stmt) = 0;
+  virtual void visit(FuncParamStmt& stmt) = 0;
+  virtual void visit(FuncStmt& stmt) = 0;
+  virtual void visit(ReturnStmt& stmt) = 0;
+  virtual void visit(LambdaFuncStmt& stmt) = 0;
+  virtual void visit(InspectStmt& stmt) = 0;
+};
+
 /**
  * @brief Interface for statements.
  */
@@ -68,6 +106,7 @@ class Stmt {
 
   virtual ~Stmt() = default;
   virtual void accept(StmtVisitor& stmt_visitor) const = 0;
+  virtual void accept(MutableStmtVisitor& stmt_visitor) = 0;
 
   Stmt(Position position) : position(position){};
   Stmt(const Stmt&) = delete;
@@ -84,6 +123,9 @@ class StmtType : public Stmt {
   void accept(StmtVisitor& visitor) const override {
     visitor.visit(static_cast<const Derived&>(*this));
   }
+  void accept(MutableStmtVisitor& visitor) override {
+    visitor.visit(static_cast<Derived&>(*this));
+  }
 };
 
 class Program : public StmtType<Program> {
@@ -138,6 +180,42 @@ class WhileStmt : public StmtType<WhileStmt> {
         body(std::move(body)){};
 };
 
+class ForStmt : public StmtType<ForStmt> {
+ public:
+  VarType type;
+  std::string identifier;
+  std::unique_ptr<Expr> iterable;
+  std::unique_ptr<Stmt> body;
+
+  ForStmt(VarType type, std::string identifier, std::unique_ptr<Expr> iterable,
+          std::unique_ptr<Stmt> body, Position position)
+      : StmtType(position),
+        type(std::move(type)),
+        identifier(std::move(identifier)),
+        iterable(std::move(iterable)),
+        body(std::move(body)){};
+};
+
+/**
+ * @brief Loop over int values in [\ref begin, \ref end).
+ */
+class ForRangeStmt : public StmtType<ForRangeStmt> {
+ public:
+  std::string identifier;
+  std::unique_ptr<Expr> begin;
+  std::unique_ptr<Expr> end;
+  std::unique_ptr<Stmt> body;
+
+  ForRangeStmt(std::string identifier, std::unique_ptr<Expr> begin,
+               std::unique_ptr<Expr> end, std::unique_ptr<Stmt> body,
+               Position position)
+      : StmtType(position),
+        identifier(std::move(identifier)),
+        begin(std::move(begin)),
+        end(std::move(end)),
+        body(std::move(body)){};
+};
+
 class VarDeclStmt : public StmtType<VarDeclStmt> {
  public:
   VarType type;
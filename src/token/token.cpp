@@ -2,6 +2,30 @@
 
 #include <magic_enum/magic_enum.hpp>
 
+VarType VarType::array_of(VarType element) {
+  VarType type(ARRAY);
+  type.element = std::make_shared<const VarType>(std::move(element));
+  return type;
+}
+
+VarType VarType::map_of(VarType key, VarType value) {
+  VarType type(MAP);
+  type.key = std::make_shared<const VarType>(std::move(key));
+  type.element = std::make_shared<const VarType>(std::move(value));
+  return type;
+}
+
+bool operator==(const VarType& lhs, const VarType& rhs) {
+  if (lhs.type != rhs.type || lhs.name != rhs.name) {
+    return false;
+  }
+  auto same = [](const std::shared_ptr<const VarType>& lhs,
+                 const std::shared_ptr<const VarType>& rhs) {
+    return lhs && rhs ? *lhs == *rhs : lhs == rhs;
+  };
+  return same(lhs.element, rhs.element) && same(lhs.key, rhs.key);
+}
+
 VarType Token::get_var_type() const {
   switch (this->get_type()) {
     case TOKEN_INT:
@@ -5,6 +5,7 @@
 #ifndef BOALANG_TOKEN_HPP
 #define BOALANG_TOKEN_HPP
 
+#include <memory>
 #include <ostream>
 #include <string>
 #include <variant>
@@ -16,15 +17,30 @@ using value_t =
     std::variant<std::monostate, std::string, int, float,
                  bool>; /**< Variant of all available value types. */
 
-enum BuiltinType { IDENTIFIER, INT, FLOAT, STR, BOOL, VOID };
+enum BuiltinType { IDENTIFIER, INT, FLOAT, STR, BOOL, VOID, ARRAY, MAP };
 
 struct VarType {
   std::string name;
   BuiltinType type;
+  std::shared_ptr<const VarType> element; /**< Element type of ARRAY, value
+                                             type of MAP. */
+  std::shared_ptr<const VarType> key;     /**< Key type of MAP. */
 
   VarType(BuiltinType type) : type(type){};
   VarType(std::string name, BuiltinType type)
       : name(std::move(name)), type(type){};
+
+  /**
+   * @brief Constructs type of arrays holding \p element values.
+   */
+  static VarType array_of(VarType element);
+
+  /**
+   * @brief Constructs type of maps from \p key to \p value.
+   */
+  static VarType map_of(VarType key, VarType value);
+
+  friend bool operator==(const VarType& lhs, const VarType& rhs);
 };
 
 /**
@@ -39,6 +55,8 @@ enum TokenType {
   TOKEN_RPAREN,
   TOKEN_LBRACE,
   TOKEN_RBRACE,
+  TOKEN_LBRACKET,
+  TOKEN_RBRACKET,
   TOKEN_COMMA,
   TOKEN_DOT,
   TOKEN_MINUS,
@@ -56,7 +74,8 @@ enum TokenType {
   TOKEN_NOT_EQUAL,
   TOKEN_LESS_EQUAL,
   TOKEN_GREATER_EQUAL,
-  TOKEN_ARROW,  // '=>'
+  TOKEN_ARROW,    // '=>'
+  TOKEN_DOT_DOT,  // '..'
 
   // LITERALS
   TOKEN_IDENTIFIER,
@@ -73,6 +92,8 @@ enum TokenType {
   TOKEN_TRUE,
   TOKEN_FALSE,
   TOKEN_WHILE,
+  TOKEN_FOR,
+  TOKEN_IN,
   TOKEN_RETURN,
   TOKEN_IS,
   TOKEN_AS,
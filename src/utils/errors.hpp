@@ -57,4 +57,13 @@ class RuntimeError : public std::runtime_error {
                            message){};
 };
 
+/**
+ * @brief Represents an error raised by a native function, reported by the
+ * interpreter as RuntimeError at the call position.
+ */
+class NativeError : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
 #endif  // BOALANG_ERRORS_HPP
@@ -0,0 +1,95 @@
+/*! @file thread_pool.hpp
+    @brief Fixed-size thread pool.
+*/
+
+#ifndef BOALANG_THREAD_POOL_HPP
+#define BOALANG_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Runs submitted tasks on a fixed number of worker threads.
+ *
+ * Destructor waits for queued tasks to finish.
+ */
+class ThreadPool {
+  std::vector<std::thread> workers_;        /**< Worker threads. */
+  std::queue<std::function<void()>> tasks_; /**< Tasks waiting to be run. */
+  std::mutex mutex_;                        /**< Guards tasks_ and stopping_. */
+  std::condition_variable cv_; /**< Signals new tasks or stopping. */
+  bool stopping_ = false;      /**< Set when the pool is destroyed. */
+
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop();
+      }
+      task();
+    }
+  }
+
+ public:
+  /**
+   * @brief Starts \p threads workers (at least one).
+   */
+  explicit ThreadPool(std::size_t threads) {
+    threads = std::max<std::size_t>(threads, 1);
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  [[nodiscard]] std::size_t size() const { return workers_.size(); }
+
+  /**
+   * @brief Queues \p task to be run by a worker.
+   * @return Future holding result or exception thrown by \p task.
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<F>> submit(F&& task) {
+    using result_t = std::invoke_result_t<F>;
+    auto packaged =
+        std::make_shared<std::packaged_task<result_t()>>(std::forward<F>(task));
+    auto future = packaged->get_future();
+    {
+      std::lock_guard lock(mutex_);
+      tasks_.emplace([packaged] { (*packaged)(); });
+    }
+    cv_.notify_one();
+    return future;
+  }
+};
+
+#endif  // BOALANG_THREAD_POOL_HPP
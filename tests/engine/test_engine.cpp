@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include "../utils.hpp"
+#include "engine/engine.hpp"
+
+TEST(EngineTest, output_to_sink) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  engine.run(boalang::Engine::compile("print \"hello\"; print 1 + 2;"));
+  EXPECT_EQ(out.str(), "hello\n3\n");
+}
+
+TEST(EngineTest, runs_reset_global_state) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  auto script = boalang::Engine::compile(R"(
+    mut int x = 1;
+    x = x + 1;
+    int f() { return x; }
+    print f();
+  )");
+  for (int i = 0; i < 3; ++i) {
+    engine.run(script);
+  }
+  EXPECT_EQ(out.str(), "2\n2\n2\n");
+}
+
+TEST(EngineTest, runs_after_runtime_error) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  auto failing = boalang::Engine::compile(R"(
+    int f(int a) { return a / 0; }
+    print f(1);
+  )");
+  EXPECT_THROW(engine.run(failing), RuntimeError);
+  EXPECT_THROW(engine.run(boalang::Engine::compile("print f(1);")),
+               RuntimeError);
+  engine.run(boalang::Engine::compile("int a = 1; print a;"));
+  EXPECT_EQ(out.str(), "1\n");
+}
+
+TEST(EngineTest, runs_after_error_with_pending_tail_call) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  auto failing = boalang::Engine::compile(R"(
+    int f(int n) {
+      mut int i = 0;
+      while (10 / (1 - i) > 0) {
+        i = i + 1;
+        return f(0);
+      }
+      return 0;
+    }
+    print f(1);
+  )");
+  EXPECT_THROW(engine.run(failing), RuntimeError);
+  engine.run(boalang::Engine::compile(R"(
+    int g(int a, int b) {
+      print a;
+      return a;
+    }
+    print g(5, 6);
+  )"));
+  EXPECT_EQ(out.str(), "5\n5\n");
+}
+
+TEST(EngineTest, host_functions) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  std::vector<std::string> logged;
+  engine.register_function("repeat", STR, {STR, INT},
+                           [](const std::vector<boalang::Value>& args) {
+                             std::string result;
+                             for (int i = 0; i < std::get<int>(args[1]); ++i) {
+                               result += std::get<std::string>(args[0]);
+                             }
+                             return boalang::Value(result);
+                           });
+  engine.register_function("log", VOID, {STR},
+                           [&](const std::vector<boalang::Value>& args) {
+                             logged.push_back(std::get<std::string>(args[0]));
+                             return boalang::Value();
+                           });
+
+  auto script = boalang::Engine::compile(R"(
+    str s = repeat("ab", 3);
+    log(s);
+    print repeat(s, 2);
+  )");
+  engine.run(script);
+  engine.run(script);
+  EXPECT_EQ(out.str(), "abababababab\nabababababab\n");
+  EXPECT_EQ(logged, std::vector<std::string>(2, "ababab"));
+}
+
+TEST(EngineTest, host_function_types_checked) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  engine.register_function("half", INT, {INT},
+                           [](const std::vector<boalang::Value>& args) {
+                             if (std::get<int>(args[0]) % 2) {
+                               return boalang::Value(0.5F);
+                             }
+                             return boalang::Value(std::get<int>(args[0]) / 2);
+                           });
+
+  engine.run(boalang::Engine::compile("print half(4);"));
+  EXPECT_EQ(out.str(), "2\n");
+  EXPECT_THROW(
+      {
+        try {
+          engine.run(boalang::Engine::compile("print half(\"4\");"));
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Type mismatch"));
+          throw;
+        }
+      },
+      RuntimeError);
+  EXPECT_THROW(engine.run(boalang::Engine::compile("print half(3);")),
+               RuntimeError);
+  EXPECT_THROW(engine.run(boalang::Engine::compile("print half(1, 2);")),
+               RuntimeError);
+  EXPECT_THROW(engine.register_function(
+                   "f", INT, {VarType("S", IDENTIFIER)},
+                   [](const std::vector<boalang::Value>&) { return 0; }),
+               std::invalid_argument);
+}
+
+TEST(EngineTest, code_defined_functions_take_precedence) {
+  std::ostringstream out;
+  boalang::Engine engine(out);
+  engine.register_function(
+      "f", INT, {}, [](const std::vector<boalang::Value>&) { return 1; });
+  engine.run(boalang::Engine::compile("print f();"));
+  engine.run(boalang::Engine::compile("int f() { return 2; } print f();"));
+  engine.run(boalang::Engine::compile("print f();"));
+  EXPECT_EQ(out.str(), "1\n2\n1\n");
+}
+
+TEST(EngineTest, concurrent_engines_share_script) {
+  auto script = boalang::Engine::compile(R"(
+    struct P { int x; str s; }
+    variant V { int, P };
+    mut str acc = "";
+    mut int i = 0;
+    while (i < 20) {
+      P p = {i, "a"};
+      V v = p;
+      inspect v {
+        P q => { acc = acc + q.s; }
+        default => {}
+      }
+      i = i + 1;
+    }
+    print acc;
+    print id(i);
+  )");
+
+  std::vector<std::string> outputs(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < outputs.size(); ++t) {
+    threads.emplace_back([&, t] {
+      std::ostringstream out;
+      boalang::Engine engine(out);
+      engine.register_function(
+          "id", INT, {INT}, [t](const std::vector<boalang::Value>& args) {
+            return boalang::Value(std::get<int>(args[0]) + static_cast<int>(t));
+          });
+      for (int run = 0; run < 50; ++run) {
+        engine.run(script);
+      }
+      outputs[t] = out.str();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t t = 0; t < outputs.size(); ++t) {
+    std::string expected;
+    for (int run = 0; run < 50; ++run) {
+      expected += std::string(20, 'a') + "\n" + std::to_string(20 + t) + "\n";
+    }
+    EXPECT_EQ(outputs[t], expected);
+  }
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "../utils.hpp"
+#include "engine/engine.hpp"
+
+static const std::string COUNTER = R"(
+mut int i = 0;
+while (i < 3) {
+  print i;
+  i = i + 1;
+}
+)";
+
+TEST(TaskTests, suspends_after_slice_of_steps) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 1;
+  auto task = engine.start(boalang::Engine::compile(COUNTER), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_EQ(out.str(), "0\n");
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_EQ(out.str(), "0\n1\n");
+  while (task->resume() != boalang::Task::Status::FINISHED) {
+  }
+  EXPECT_EQ(out.str(), "0\n1\n2\n");
+  EXPECT_TRUE(task->finished());
+}
+
+TEST(TaskTests, interleaves_tasks_and_threads) {
+  std::ostringstream first_out;
+  std::ostringstream second_out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 1;
+  auto script = boalang::Engine::compile(COUNTER);
+  auto first = engine.start(script, first_out);
+  auto second = engine.start(script, second_out);
+
+  first->resume();
+  second->resume();
+  std::thread([&] { first->resume(); }).join();
+  second->resume();
+  EXPECT_EQ(first_out.str(), "0\n1\n");
+  EXPECT_EQ(second_out.str(), "0\n1\n");
+  while (first->resume() != boalang::Task::Status::FINISHED) {
+  }
+  EXPECT_EQ(first_out.str(), "0\n1\n2\n");
+  EXPECT_EQ(second_out.str(), "0\n1\n");
+}
+
+TEST(TaskTests, host_function_yields) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.register_native("wait", [] { boalang::Task::yield_current(); });
+  auto task = engine.start(
+      boalang::Engine::compile("print 1;\nwait();\nprint 2;\n"), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_EQ(out.str(), "1\n");
+  EXPECT_EQ(task->resume(), boalang::Task::Status::FINISHED);
+  EXPECT_EQ(out.str(), "1\n2\n");
+}
+
+TEST(TaskTests, error_finishes_task) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 10;
+  engine.limits().max_steps = 25;
+  auto task = engine.start(boalang::Engine::compile("while (true) {}"), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_THROW(task->resume(), RuntimeError);
+  EXPECT_TRUE(task->finished());
+}
+
+TEST(TaskTests, destroying_suspended_task_unwinds_its_stack) {
+  struct Guard {
+    bool& unwound;
+    ~Guard() { unwound = true; }
+  };
+
+  bool unwound = false;
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.register_native("wait", [&unwound] {
+    Guard guard{unwound};
+    boalang::Task::yield_current();
+  });
+  auto task = engine.start(boalang::Engine::compile("wait();"), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_FALSE(unwound);
+  task.reset();
+  EXPECT_TRUE(unwound);
+}
+
+TEST(TaskTests, destroying_task_resumes_body_that_swallows_unwinding) {
+  int swallowed = 0;
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.register_native("wait", [&swallowed] {
+    try {
+      boalang::Task::yield_current();
+    } catch (...) {
+      ++swallowed;
+    }
+    boalang::Task::yield_current();
+  });
+  auto task = engine.start(boalang::Engine::compile("wait();"), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  task.reset();
+  EXPECT_EQ(swallowed, 1);
+}
+
+TEST(TaskTests, destroying_task_drops_error_thrown_while_unwinding) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.register_native("wait", [] {
+    try {
+      boalang::Task::yield_current();
+    } catch (...) {
+      throw std::runtime_error("unwinding");
+    }
+  });
+  auto task = engine.start(boalang::Engine::compile("wait();"), out);
+
+  EXPECT_EQ(task->resume(), boalang::Task::Status::SUSPENDED);
+  EXPECT_NO_THROW(task.reset());
+}
+
+TEST(TaskTests, suspends_deep_in_recursion) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 1;
+  auto task = engine.start(boalang::Engine::compile(R"(
+    int depth(int n) {
+      if (n == 0) {
+        return 0;
+      }
+      return depth(n - 1) + 1;
+    }
+    print depth(45);
+  )"),
+                           out);
+
+  int resumes = 1;
+  while (task->resume() != boalang::Task::Status::FINISHED) {
+    ++resumes;
+  }
+  EXPECT_EQ(out.str(), "45\n");
+  EXPECT_EQ(resumes, 46);
+}
+
+TEST(TaskTests, destroying_suspended_task_restores_active_tracker) {
+  std::ostringstream out;
+  boalang::Engine engine;
+  engine.limits().slice_steps = 1;
+  auto task = engine.start(boalang::Engine::compile("while (true) {}"), out);
+  task->resume();
+  task.reset();
+  EXPECT_EQ(MemoryTracker::active(), nullptr);
+}
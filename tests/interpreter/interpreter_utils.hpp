@@ -7,9 +7,7 @@
 
 inline static std::unique_ptr<Program> get_ast(const std::string &code) {
   StringSource source(code);
-  Lexer lexer(source);
-  LexerCommentFilter filter(lexer);
-  Parser parser(filter);
+  Parser parser(Lexer(source).tokenize());
   return parser.parse();
 }
 
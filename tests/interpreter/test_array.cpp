@@ -0,0 +1,179 @@
+#include "interpreter_utils.hpp"
+
+TEST(InterpreterArrayTests, index_and_assign) {
+  std::string code = R"(
+    mut int[] a = {1, 2, 3};
+    a[1] = a[0] + a[2];
+    print a[1];
+    mut int i = 2;
+    print a[i] * 10;
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_TRUE(str_contains(stdout, "4"));
+  EXPECT_TRUE(str_contains(stdout, "30"));
+}
+
+TEST(InterpreterArrayTests, push_and_size) {
+  std::string code = R"(
+    mut str[] a = {};
+    print size(a);
+    push(a, "x");
+    push(a, "y");
+    print size(a);
+    print a[0] + a[1];
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "0\n2\nxy\n");
+}
+
+TEST(InterpreterArrayTests, for_in_loop) {
+  std::string code = R"(
+    mut int[] a = {1, 2, 3};
+    mut int sum = 0;
+    for (int x in a) {
+      sum = sum + x;
+      push(a, x);
+    }
+    print sum;
+    print size(a);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "6\n6\n");
+}
+
+TEST(InterpreterArrayTests, for_in_return) {
+  std::string code = R"(
+    int first_even(int[] a) {
+      for (int x in a) {
+        if (x / 2 * 2 == x) {
+          return x;
+        }
+      }
+      return 0;
+    }
+    print first_even({3, 5, 8, 10});
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "8\n");
+}
+
+TEST(InterpreterArrayTests, copied_on_assign_and_call) {
+  std::string code = R"(
+    void clear(int[] a) {
+      a[0] = 0;
+    }
+    int[] make() {
+      return {7, 8};
+    }
+    mut int[] a = make();
+    mut int[] b = a;
+    b[0] = 1;
+    clear(a);
+    print a[0];
+    print b[0];
+    a = {9};
+    print size(a);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "7\n1\n1\n");
+}
+
+TEST(InterpreterArrayTests, struct_and_nested_elements) {
+  std::string code = R"(
+    struct P {mut int x; int[] tags;}
+    mut P[] ps = {{1, {2, 3}}};
+    P p = {4, {}};
+    push(ps, p);
+    ps[1].x = 5;
+    print ps[0].tags[1];
+    print ps[1].x;
+    print p.x;
+
+    mut int[][] grid = {{1}, {}};
+    push(grid[1], 6);
+    print grid[1][0];
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "3\n5\n4\n6\n");
+}
+
+TEST(InterpreterArrayTests, const_array_elements) {
+  std::string code = R"(
+    int[] a = {1};
+    a[0] = 2;
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(
+              str_contains(e.what(), "Tried assigning value to a const 'a'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterArrayTests, index_out_of_bounds) {
+  std::string code = R"(
+    int[] a = {1, 2};
+    print a[2];
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(),
+                                   "Index 2 out of bounds for 'a' of size 2"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterArrayTests, element_type_mismatch) {
+  std::string code = R"(
+    mut int[] a = {1};
+    push(a, "2");
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(
+              str_contains(e.what(), "Type mismatch in element of 'a'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterArrayTests, loop_variable_type_mismatch) {
+  std::string code = R"(
+    int[] a = {1};
+    for (float x in a) {}
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "different type than array"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
@@ -349,3 +349,112 @@ TEST(InterpreterFunctionTests, return_val_not_assigned) {
       },
       RuntimeError);
 }
+
+TEST(InterpreterFunctionTests, tail_recursion_deeper_than_limit) {
+  std::string code = R"(
+    int sum(int n, int acc) {
+        if (n == 0) {
+            return acc;
+        }
+        return sum(n - 1, acc + n);
+    }
+
+    print sum(10000, 0);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_TRUE(str_contains(stdout, "50005000"));
+}
+
+TEST(InterpreterFunctionTests, tail_call_from_nested_blocks) {
+  std::string code = R"(
+    str repeat(str s, int times, str acc) {
+        while (times > 0) {
+            str next = acc + s;
+            if (true) {
+                return repeat(s, times - 1, next);
+            }
+        }
+        return acc;
+    }
+
+    print repeat("ab", 100, "");
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  std::string expected;
+  for (int i = 0; i < 100; ++i) {
+    expected += "ab";
+  }
+  EXPECT_TRUE(str_contains(stdout, expected));
+  EXPECT_FALSE(str_contains(stdout, expected + "ab"));
+}
+
+TEST(InterpreterFunctionTests, non_tail_recursion_depth_exceeded) {
+  std::string code = R"(
+    int sum(int n) {
+        if (n == 0) {
+            return 0;
+        }
+        return n + sum(n - 1);
+    }
+
+    print sum(100);
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(
+              str_contains(e.what(), "Maximum recursion depth exceeded"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterFunctionTests, tail_call_args_type_mismatch) {
+  std::string code = R"(
+    int func(int n) {
+        if (n == 0) {
+            return 0;
+        }
+        return func("a");
+    }
+
+    print func(3);
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(
+              e.what(), "Type mismatch in call arguments for 'func'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterFunctionTests, missing_return_after_tail_call_position) {
+  std::string code =
+      "int f(int n) { if (n > 0) { return f(n - 1); } } print f(2);";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(),
+                                   "Line 1 column 36: Non-void "
+                                   "function did not return a "
+                                   "value"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
@@ -395,3 +395,106 @@ TEST_P(InterpreterInvalidDivisionTests, invalid_arithmetic) {
 INSTANTIATE_TEST_SUITE_P(InterpreterGeneralTests,
                          InterpreterInvalidDivisionTests,
                          ::testing::Values("1 / 0", "1.0 / 0.0"));
+
+class InterpreterOverflowTests
+    : public ::testing::TestWithParam<std::pair<std::string, std::string>> {};
+
+TEST_P(InterpreterOverflowTests, overflow) {
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout("print " + GetParam().first + ";");
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), GetParam().second));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    InterpreterGeneralTests, InterpreterOverflowTests,
+    ::testing::Values(
+        std::make_pair("2147483647 + 1", "Detected overflow"),
+        std::make_pair("65536 * 65536", "Detected overflow"),
+        std::make_pair("(0 - 65536) * (0 - 65536)", "Detected overflow"),
+        std::make_pair("0 - 2147483647 - 2", "Detected underflow"),
+        std::make_pair("(0 - 65536) * 65536", "Detected underflow"),
+        std::make_pair("65536 * (0 - 65536)", "Detected underflow"),
+        std::make_pair("(0 - 2147483647 - 1) / (0 - 1)", "Detected overflow")));
+
+TEST(InterpreterGeneralTests, multiplication_by_negative) {
+  std::string code = R"(
+    print 0 * (0 - 5);
+    print 3 * (0 - 1);
+  )";
+  EXPECT_EQ(capture_interpreted_stdout(code), "0\n-3\n");
+}
+
+TEST(InterpreterGeneralTests, for_range_loop) {
+  std::string code = R"(
+    mut int n = 3;
+    for (int i in 0 - 1..n) {
+      n = 10;
+      print i;
+    }
+    for (int i in 5..5) {
+      print i;
+    }
+  )";
+  EXPECT_EQ(capture_interpreted_stdout(code), "-1\n0\n1\n2\n");
+}
+
+TEST(InterpreterGeneralTests, for_range_return) {
+  std::string code = R"(
+    int first_square_above(int limit) {
+      for (int i in 0..limit) {
+        int square = i * i;
+        if (square > limit) {
+          return square;
+        }
+      }
+      return 0;
+    }
+    print first_square_above(10);
+  )";
+  EXPECT_EQ(capture_interpreted_stdout(code), "16\n");
+}
+
+TEST(InterpreterGeneralTests, for_range_variable_is_const) {
+  std::string code = R"(
+    for (int i in 0..3) {
+      i = 5;
+    }
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(
+              str_contains(e.what(), "Tried assigning value to a const 'i'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterGeneralTests, loop_body_declarations_per_iteration) {
+  std::string code = R"(
+    mut int i = 0;
+    while (i < 3) {
+      int square = i * i;
+      int twice(int a) { return a * 2; }
+      struct P {int x;}
+      P p = {twice(square)};
+      {
+        int inner = p.x + 1;
+        print inner;
+      }
+      i = i + 1;
+    }
+  )";
+  EXPECT_EQ(capture_interpreted_stdout(code), "1\n3\n9\n");
+}
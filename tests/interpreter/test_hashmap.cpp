@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "interpreter/hashmap/hashmap.hpp"
+
+TEST(HashMapTests, insert_find_erase) {
+  HashMap<int> map;
+  map.insert_or_assign(StrValue("a"), 1);
+  map.insert_or_assign(2, 2);
+  map.insert_or_assign(StrValue("a"), 3);
+  EXPECT_EQ(map.size(), 2);
+  ASSERT_NE(map.find(StrValue("a")), nullptr);
+  EXPECT_EQ(*map.find(StrValue("a")), 3);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(StrValue("2")));
+
+  EXPECT_TRUE(map.erase(2));
+  EXPECT_FALSE(map.erase(2));
+  EXPECT_EQ(map.find(2), nullptr);
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(HashMapTests, iterates_in_insertion_order) {
+  HashMap<int> map;
+  for (int key : {5, 1, 4, 2, 3}) {
+    map.insert_or_assign(key, key * 10);
+  }
+  map.erase(4);
+  map.insert_or_assign(4, 0);
+  map.insert_or_assign(5, 50);
+
+  std::vector<int> keys;
+  map.for_each([&keys](const map_key_t& key, int) {
+    keys.push_back(std::get<int>(key));
+  });
+  EXPECT_EQ(keys, (std::vector<int>{5, 1, 2, 3, 4}));
+}
+
+TEST(HashMapTests, matches_std_map_under_churn) {
+  HashMap<int> map;
+  std::map<int, int> expected;
+  std::mt19937 random(7);
+  // keys sharing low bits collide in naive power-of-two tables
+  std::uniform_int_distribution<int> keys(0, 511);
+  for (int i = 0; i < 20000; ++i) {
+    int key = keys(random) * 4096;
+    if (random() % 3 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(key) == 1);
+    } else {
+      map.insert_or_assign(key, i);
+      expected[key] = i;
+    }
+  }
+
+  EXPECT_EQ(map.size(), expected.size());
+  for (int key = 0; key < 512 * 4096; key += 4096) {
+    auto* value = map.find(key);
+    auto it = expected.find(key);
+    ASSERT_EQ(value != nullptr, it != expected.end());
+    if (value) {
+      EXPECT_EQ(*value, it->second);
+    }
+  }
+}
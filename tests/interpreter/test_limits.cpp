@@ -0,0 +1,88 @@
+#include <sstream>
+
+#include "interpreter_utils.hpp"
+
+static void expect_limit_error(Interpreter& interpreter,
+                               const std::string& code,
+                               const std::string& message) {
+  auto program = get_ast(code);
+  EXPECT_THROW(
+      {
+        try {
+          interpreter.visit(*program);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), message)) << e.what();
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterLimitsTests, infinite_loop_stops_at_step_limit) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.limits().max_steps = 1000;
+  expect_limit_error(interpreter, R"(
+    mut int i = 0;
+    while (true) {
+      i = i + 1;
+    }
+  )",
+                     "Line 3 column 9: Step limit of 1000 exceeded");
+}
+
+TEST(InterpreterLimitsTests, steps_count_iterations_and_calls) {
+  std::string code = R"(
+    void f() {}
+    for (int i in 0..10) {
+      f();
+    }
+    int[] a = {1, 2, 3};
+    for (int x in a) {}
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.limits().max_steps = 23;
+  interpreter.visit(*get_ast(code));
+
+  interpreter.reset();
+  interpreter.limits().max_steps = 22;
+  expect_limit_error(interpreter, code, "Step limit of 22 exceeded");
+}
+
+TEST(InterpreterLimitsTests, infinite_recursion_stops_at_timeout) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.limits().timeout = std::chrono::milliseconds(20);
+  expect_limit_error(interpreter, R"(
+    int spin(int depth) {
+      mut int i = 0;
+      while (true) {
+        i = i + depth;
+      }
+      return i;
+    }
+    print spin(1);
+  )",
+                     "Time limit of 20 ms exceeded");
+}
+
+TEST(InterpreterLimitsTests, limits_apply_to_each_program) {
+  std::string code = R"(
+    mut int i = 0;
+    while (i < 100) {
+      i = i + 1;
+    }
+    print i;
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.limits().max_steps = 100;
+  interpreter.limits().timeout = std::chrono::milliseconds(10000);
+  interpreter.visit(*get_ast(code));
+  interpreter.reset();
+  interpreter.visit(*get_ast(code));
+  EXPECT_EQ(out.str(), "100\n100\n");
+}
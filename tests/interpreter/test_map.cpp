@@ -0,0 +1,139 @@
+#include "interpreter_utils.hpp"
+
+TEST(InterpreterMapTests, insert_and_lookup) {
+  std::string code = R"(
+    mut int[str] ages = {{"ann", 30}, {"bob", 25}};
+    ages["cid"] = 41;
+    ages["ann"] = ages["ann"] + 1;
+    print ages["ann"];
+    print ages["cid"];
+    print size(ages);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "31\n41\n3\n");
+}
+
+TEST(InterpreterMapTests, contains_and_remove) {
+  std::string code = R"(
+    mut str[int] names = {};
+    names[7] = "seven";
+    print contains(names, 7);
+    print remove(names, 7);
+    print remove(names, 7);
+    print contains(names, 7);
+    print size(names);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "true\ntrue\nfalse\nfalse\n0\n");
+}
+
+TEST(InterpreterMapTests, for_in_keys) {
+  std::string code = R"(
+    mut int[str] m = {{"c", 1}, {"a", 2}, {"b", 3}};
+    for (str k in m) {
+      print k;
+      remove(m, "a");
+      m["d"] = 4;
+    }
+    print size(m);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "c\nb\n3\n");
+}
+
+TEST(InterpreterMapTests, object_values) {
+  std::string code = R"(
+    struct P {mut int x;}
+    mut P[int] ps = {{1, {2}}};
+    ps[1].x = 3;
+    print ps[1].x;
+
+    mut int[][str] lists = {{"a", {}}};
+    push(lists["a"], 5);
+    print lists["a"][0];
+
+    int[][str] copy = lists;
+    push(lists["a"], 6);
+    print size(copy["a"]);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "3\n5\n1\n");
+}
+
+TEST(InterpreterMapTests, function_params) {
+  std::string code = R"(
+    int total(int[str] m) {
+      mut int sum = 0;
+      for (str k in m) {
+        sum = sum + m[k];
+      }
+      m["x"] = 100;
+      return sum;
+    }
+    int[str] m = {{"a", 1}, {"b", 2}};
+    print total(m);
+    print total({{"c", 3}});
+    print size(m);
+  )";
+
+  auto stdout = capture_interpreted_stdout(code);
+  EXPECT_EQ(stdout, "3\n3\n2\n");
+}
+
+TEST(InterpreterMapTests, missing_key) {
+  std::string code = R"(
+    int[str] m = {};
+    print m["a"];
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Key not found in 'm'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterMapTests, key_type_mismatch) {
+  std::string code = R"(
+    mut int[str] m = {};
+    m[1] = 1;
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Type mismatch in key of 'm'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterMapTests, const_map) {
+  std::string code = R"(
+    int[str] m = {{"a", 1}};
+    remove(m, "a");
+  )";
+
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout(code);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Tried modifying a const 'm'"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
@@ -0,0 +1,95 @@
+#include <sstream>
+
+#include "interpreter_utils.hpp"
+
+static const std::string FIB = R"(
+    int fib(int n) {
+      if (n < 2) {
+        return n;
+      }
+      return fib(n - 1) + fib(n - 2);
+    }
+)";
+
+TEST(InterpreterMemoTests, pure_recursion_runs_once_per_argument) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.memo_capacity() = 100;
+  // without cache it would take hundreds of thousands of calls
+  interpreter.limits().max_steps = 1000;
+  interpreter.visit(*get_ast(FIB + "print fib(25);"));
+  EXPECT_EQ(out.str(), "75025\n");
+
+  auto stats = interpreter.memo_stats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].first, "fib");
+  EXPECT_EQ(stats[0].second.misses, 26);
+  EXPECT_EQ(stats[0].second.hits, 23);
+  EXPECT_EQ(stats[0].second.entries, 26);
+}
+
+TEST(InterpreterMemoTests, disabled_by_default) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.visit(*get_ast(FIB + "print fib(10);"));
+  EXPECT_EQ(out.str(), "55\n");
+  EXPECT_TRUE(interpreter.memo_stats().empty());
+}
+
+TEST(InterpreterMemoTests, side_effects_are_not_cached) {
+  std::string code = R"(
+    int printing(int n) {
+      print n;
+      return n;
+    }
+    int calls_printing(int n) {
+      return printing(n);
+    }
+    mut int counter = 0;
+    int reads_caller(int n) {
+      return n + counter;
+    }
+    int writes_caller(int n) {
+      counter = counter + 1;
+      return n;
+    }
+    str local(str s, bool twice) {
+      mut str result = s;
+      if (twice) {
+        result = result + s;
+      }
+      return result;
+    }
+    for (int i in 0..2) {
+      calls_printing(7);
+      print reads_caller(1);
+      writes_caller(1);
+      print local("ab", true);
+    }
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.memo_capacity() = 100;
+  interpreter.visit(*get_ast(code));
+  EXPECT_EQ(out.str(), "7\n1\nabab\n7\n2\nabab\n");
+
+  auto stats = interpreter.memo_stats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].first, "local");
+  EXPECT_EQ(stats[0].second.hits, 1);
+}
+
+TEST(InterpreterMemoTests, capacity_evicts_oldest_results) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.memo_capacity() = 4;
+  interpreter.visit(*get_ast(FIB + "print fib(20);"));
+  EXPECT_EQ(out.str(), "6765\n");
+
+  auto stats = interpreter.memo_stats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].second.entries, 4);
+  EXPECT_GT(stats[0].second.evictions, 0);
+  EXPECT_GT(stats[0].second.hit_rate(), 0.);
+}
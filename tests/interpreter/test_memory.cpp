@@ -0,0 +1,101 @@
+#include <sstream>
+
+#include "interpreter_utils.hpp"
+
+TEST(InterpreterMemoryTests, tracker_counts_live_and_peak) {
+  MemoryTracker tracker;
+  tracker.set_limit(100);
+  tracker.allocate(60);
+  tracker.release(20);
+  tracker.allocate(50);
+  EXPECT_EQ(tracker.live(), 90);
+  EXPECT_EQ(tracker.peak(), 90);
+  EXPECT_THROW(tracker.allocate(11), MemoryLimitError);
+  EXPECT_EQ(tracker.live(), 90);
+  tracker.release(90);
+  EXPECT_EQ(tracker.live(), 0);
+  EXPECT_EQ(tracker.peak(), 90);
+}
+
+TEST(InterpreterMemoryTests, charges_follow_active_tracker) {
+  MemoryTracker tracker;
+  {
+    ActiveTracker active(tracker);
+    StrValue str(std::string(100, 'x'));
+    Variable copy = Variable(VarType(STR), "s", false, str).clone();
+    EXPECT_GE(tracker.live(), 100 + sizeof(Variable));
+  }
+  EXPECT_EQ(tracker.live(), 0);
+
+  StrValue untracked(std::string(100, 'x'));
+  EXPECT_EQ(tracker.live(), 0);
+}
+
+TEST(InterpreterMemoryTests, released_after_block) {
+  std::string code = R"(
+    {
+      mut str[] a = {};
+      mut int i = 0;
+      while (i < 1000) {
+        push(a, "a string too long to be stored inline");
+        i = i + 1;
+      }
+    }
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.visit(*get_ast(code));
+  EXPECT_GT(interpreter.memory().peak(), 1000 * sizeof(eval_value_t));
+  EXPECT_LT(interpreter.memory().live(), 1000);
+}
+
+TEST(InterpreterMemoryTests, string_concatenation_over_limit) {
+  std::string code = R"(
+    mut str s = "a string too long to be stored inline";
+    while (true) {
+      s = s + s;
+    }
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.memory().set_limit(1 << 20);
+  EXPECT_THROW(
+      {
+        try {
+          interpreter.visit(*get_ast(code));
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(
+              e.what(), "Line 4 column 9: Memory limit of 1048576 bytes"));
+          throw;
+        }
+      },
+      RuntimeError);
+  EXPECT_LE(interpreter.memory().peak(), 1 << 20);
+}
+
+TEST(InterpreterMemoryTests, recursion_over_limit) {
+  std::string code = R"(
+    struct Node {int value; int[] payload;}
+    int grow(int depth) {
+      Node node = {depth, {1, 2, 3, 4, 5, 6, 7, 8}};
+      return grow(depth + 1) + 1;
+    }
+    grow(0);
+  )";
+
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.memory().set_limit(4096);
+  EXPECT_THROW(
+      {
+        try {
+          interpreter.visit(*get_ast(code));
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Memory limit of 4096 bytes"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
@@ -0,0 +1,83 @@
+#include <sstream>
+
+#include "interpreter_utils.hpp"
+
+static std::string interpret_with(const std::string& code,
+                                  Interpreter& interpreter,
+                                  std::ostringstream& out) {
+  auto program = get_ast(code);
+  interpreter.visit(*program);
+  return out.str();
+}
+
+TEST(InterpreterNativeTests, typed_functions) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.natives().define("add", [](int a, int b) { return a + b; });
+  interpreter.natives().define("scale", [](float a) { return a * 2.F; });
+  interpreter.natives().define("neg", [](bool a) { return !a; });
+  interpreter.natives().define(
+      "len", [](std::string_view s) { return static_cast<int>(s.size()); });
+  interpreter.natives().define("twice",
+                               [](const StrValue& s) { return s + s; });
+  interpreter.natives().define("upper", [](std::string s) {
+    for (auto& c : s) {
+      c = static_cast<char>(std::toupper(c));
+    }
+    return s;
+  });
+
+  EXPECT_EQ(interpret_with(R"(
+    int a = 40;
+    print add(a, 2);
+    print scale(1.5);
+    print neg(a > 1);
+    str s = "abc";
+    print len(s + s);
+    print twice(upper(s));
+  )",
+                           interpreter, out),
+            "42\n3.000000\nfalse\n6\nABCABC\n");
+}
+
+TEST(InterpreterNativeTests, void_function) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  std::string seen;
+  interpreter.natives().define("log", [&](std::string_view s) { seen += s; });
+  interpret_with(R"(
+    log("a");
+    void f() { log("b"); }
+    f();
+  )",
+                 interpreter, out);
+  EXPECT_EQ(seen, "ab");
+}
+
+TEST(InterpreterNativeTests, argument_types_checked) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.natives().define("add", [](int a, int b) { return a + b; });
+  EXPECT_THROW(
+      {
+        try {
+          interpret_with("print add(1, 2.0);", interpreter, out);
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Type mismatch"));
+          throw;
+        }
+      },
+      RuntimeError);
+  EXPECT_THROW(interpret_with("print add(1);", interpreter, out), RuntimeError);
+  EXPECT_THROW(interpret_with("int x = add(1, 2) as str;", interpreter, out),
+               RuntimeError);
+}
+
+TEST(InterpreterNativeTests, result_typed_against_declaration) {
+  std::ostringstream out;
+  Interpreter interpreter(out);
+  interpreter.natives().define("f", [](int a) { return a; });
+  EXPECT_THROW(interpret_with("str s = f(1);", interpreter, out), RuntimeError);
+  interpret_with("int i = f(1); print i;", interpreter, out);
+  EXPECT_EQ(out.str(), "1\n");
+}
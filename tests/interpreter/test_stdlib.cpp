@@ -0,0 +1,81 @@
+#include "interpreter_utils.hpp"
+
+TEST(InterpreterStdlibTests, math) {
+  std::string code = R"(
+    print abs(0 - 5);
+    print abs(7);
+    print min(3, 0 - 2);
+    print max(3, 0 - 2);
+    print pow(2.0, 10.0);
+    print sqrt(2.25);
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "5\n7\n-2\n3\n1024.000000\n1.500000\n");
+}
+
+TEST(InterpreterStdlibTests, strings) {
+  std::string code = R"(
+    str s = "hello world";
+    print len(s);
+    print len("");
+    print substr(s, 6, 5);
+    print substr(s, 6, 100);
+    print substr(s, 11, 1);
+    print find(s, "o");
+    print find(s, "xyz");
+    print to_upper(s);
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "11\n0\nworld\nworld\n\n4\n-1\nHELLO WORLD\n");
+}
+
+TEST(InterpreterStdlibTests, errors_at_call_position) {
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout("int i = 1;\nprint substr(\"ab\", 3, 1);");
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Line 2"));
+          EXPECT_TRUE(str_contains(e.what(), "out of range"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterStdlibTests, float_overflow) {
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout("print pow(10.0, 100.0);");
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Detected overflow"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterStdlibTests, argument_types_checked) {
+  EXPECT_THROW(
+      {
+        try {
+          capture_interpreted_stdout("print abs(1.5);");
+        } catch (const RuntimeError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Type mismatch"));
+          throw;
+        }
+      },
+      RuntimeError);
+}
+
+TEST(InterpreterStdlibTests, user_functions_shadow_stdlib) {
+  std::string code = R"(
+    int abs(int a) { return 42; }
+    print abs(0 - 1);
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code), "42\n");
+}
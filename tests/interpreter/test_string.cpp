@@ -0,0 +1,65 @@
+#include "interpreter_utils.hpp"
+
+TEST(InterpreterStringTests, concatenation_keeps_value_semantics) {
+  std::string code = R"(
+    mut str a = "0123456789012345678901234567890";
+    str b = a + "x";
+    str c = a + "y";
+    print b;
+    print c;
+    print a;
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "0123456789012345678901234567890x\n"
+            "0123456789012345678901234567890y\n"
+            "0123456789012345678901234567890\n");
+}
+
+TEST(InterpreterStringTests, self_concatenation) {
+  std::string code = R"(
+    mut str a = "abcdefghijklmnopqrstuvwxyz";
+    a = a + a;
+    print a;
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz\n");
+}
+
+TEST(InterpreterStringTests, accumulate_in_loop) {
+  std::string code = R"(
+    mut str s = "";
+    mut str snapshot = "";
+    mut int i = 0;
+    while (i < 30) {
+      s = s + "ab";
+      i = i + 1;
+      if (i == 15) {
+        snapshot = s;
+      }
+    }
+    print s == "abababababababababababababababababababababababababababababab";
+    print s > "abab";
+    print (s as bool);
+    print snapshot;
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "true\ntrue\ntrue\nababababababababababababababab\n");
+}
+
+TEST(InterpreterStringTests, long_string_in_variant) {
+  std::string code = R"(
+    variant V {int, str};
+    mut str s = "a long string that does not fit inline";
+    V v = s + "!";
+    s = s + "?";
+    print v as str;
+    print s;
+  )";
+
+  EXPECT_EQ(capture_interpreted_stdout(code),
+            "a long string that does not fit inline!\n"
+            "a long string that does not fit inline?\n");
+}
@@ -309,6 +309,8 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_pair(")", TokenType::TOKEN_RPAREN),
                       std::make_pair("{", TokenType::TOKEN_LBRACE),
                       std::make_pair("}", TokenType::TOKEN_RBRACE),
+                      std::make_pair("[", TokenType::TOKEN_LBRACKET),
+                      std::make_pair("]", TokenType::TOKEN_RBRACKET),
                       std::make_pair(",", TokenType::TOKEN_COMMA),
                       std::make_pair(".", TokenType::TOKEN_DOT),
                       std::make_pair("-", TokenType::TOKEN_MINUS),
@@ -333,6 +335,8 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_pair("true", TokenType::TOKEN_TRUE),
                       std::make_pair("false", TokenType::TOKEN_FALSE),
                       std::make_pair("while", TokenType::TOKEN_WHILE),
+                      std::make_pair("for", TokenType::TOKEN_FOR),
+                      std::make_pair("in", TokenType::TOKEN_IN),
                       std::make_pair("return", TokenType::TOKEN_RETURN),
                       std::make_pair("is", TokenType::TOKEN_IS),
                       std::make_pair("as", TokenType::TOKEN_AS),
@@ -350,7 +354,8 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_pair("!=", TokenType::TOKEN_NOT_EQUAL),
                       std::make_pair("<=", TokenType::TOKEN_LESS_EQUAL),
                       std::make_pair(">=", TokenType::TOKEN_GREATER_EQUAL),
-                      std::make_pair("=>", TokenType::TOKEN_ARROW)));
+                      std::make_pair("=>", TokenType::TOKEN_ARROW),
+                      std::make_pair("..", TokenType::TOKEN_DOT_DOT)));
 
 TEST(LexerCommentFilterTest, comment_filter_valid) {
   StringSource source("void//void\nvoid/*void*/");
@@ -362,3 +367,54 @@ TEST(LexerCommentFilterTest, comment_filter_valid) {
 
   EXPECT_EQ(filter.next_token().get_type(), TokenType::TOKEN_ETX);
 }
+
+TEST(LexerTokenizeTest, tokenize_drops_comments) {
+  StringSource source("void//void\nint /*void*/ a");
+  auto tokens = Lexer(source).tokenize();
+
+  ASSERT_EQ(tokens.size(), 4);
+  EXPECT_EQ(tokens[0].get_type(), TokenType::TOKEN_VOID);
+  EXPECT_EQ(tokens[1].get_type(), TokenType::TOKEN_INT);
+  EXPECT_EQ(tokens[1].get_position().line, 2);
+  EXPECT_EQ(tokens[2].get_type(), TokenType::TOKEN_IDENTIFIER);
+  EXPECT_EQ(tokens[3].get_type(), TokenType::TOKEN_ETX);
+}
+
+TEST(LexerTokenizeTest, tokenize_int_range) {
+  StringSource source("0..n 1.5..2");
+  auto tokens = Lexer(source).tokenize();
+
+  ASSERT_EQ(tokens.size(), 7);
+  EXPECT_EQ(std::get<int>(tokens[0].get_value()), 0);
+  EXPECT_EQ(tokens[1].get_type(), TokenType::TOKEN_DOT_DOT);
+  EXPECT_EQ(tokens[2].get_type(), TokenType::TOKEN_IDENTIFIER);
+  EXPECT_EQ(tokens[3].get_type(), TokenType::TOKEN_FLOAT_VAL);
+  EXPECT_EQ(tokens[4].get_type(), TokenType::TOKEN_DOT_DOT);
+  EXPECT_EQ(tokens[5].get_type(), TokenType::TOKEN_INT_VAL);
+}
+
+TEST(LexerTokenizeTest, tokenize_empty_source) {
+  StringSource source("");
+  auto tokens = Lexer(source).tokenize();
+
+  ASSERT_EQ(tokens.size(), 1);
+  EXPECT_EQ(tokens[0].get_type(), TokenType::TOKEN_ETX);
+}
+
+TEST(LexerTokenizeTest, positions_after_long_comments) {
+  StringSource source(
+      "/* first line\n"
+      "   second line */  a\n"
+      "// comment spanning more than thirty-two characters\n"
+      "\t\t   \"string literal\" b");
+  auto tokens = Lexer(source).tokenize();
+
+  ASSERT_EQ(tokens.size(), 4);
+  EXPECT_EQ(tokens[0].get_position().line, 2);
+  EXPECT_EQ(tokens[0].get_position().column, 20);
+  EXPECT_EQ(tokens[1].get_position().line, 4);
+  EXPECT_EQ(tokens[1].get_position().column, 21);
+  EXPECT_EQ(std::get<std::string>(tokens[1].get_value()), "string literal");
+  EXPECT_EQ(tokens[2].get_position().line, 4);
+  EXPECT_EQ(tokens[2].get_position().column, 23);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "../utils.hpp"
+#include "lexer/lexer.hpp"
+#include "lexer/parallel_lexer.hpp"
+
+static std::string generate_source(std::size_t size) {
+  std::string code;
+  for (int i = 0; code.size() < size; ++i) {
+    std::string n = std::to_string(i);
+    code += "mut int x" + n + " = " + n + "; // line comment /* not open\r\n";
+    code += "print \"string with // and /* inside\" + x" + n + " as str;\n";
+    if (i % 50 == 0) {
+      // comments long enough to swallow a speculative restart point
+      code += "/*\n";
+      for (int j = 0; j < 2000; ++j) {
+        code += "  float y = 1.5; print \"unterminated\n";
+      }
+      code += "*/ float f" + n + " = 2.25;\n";
+    }
+  }
+  return code;
+}
+
+static void expect_same_tokens(const std::string& code, std::size_t jobs) {
+  StringSource source(code);
+  auto expected = Lexer(source).tokenize();
+  ThreadPool pool(jobs);
+  auto tokens = ParallelLexer(code, pool).tokenize();
+
+  ASSERT_EQ(tokens.size(), expected.size());
+  for (std::size_t i = 0; i < tokens.size(); ++i) {
+    EXPECT_EQ(tokens[i].get_type(), expected[i].get_type());
+    EXPECT_EQ(tokens[i].get_value(), expected[i].get_value());
+    EXPECT_EQ(tokens[i].get_position().line, expected[i].get_position().line);
+    EXPECT_EQ(tokens[i].get_position().column,
+              expected[i].get_position().column);
+  }
+}
+
+TEST(ParallelLexerTest, matches_sequential_lexer) {
+  expect_same_tokens(generate_source(1 << 20), 4);
+}
+
+TEST(ParallelLexerTest, single_job_and_small_sources) {
+  expect_same_tokens(generate_source(1 << 18), 1);
+  expect_same_tokens("int a = 1;", 4);
+  expect_same_tokens("", 4);
+}
+
+TEST(ParallelLexerTest, reports_first_error) {
+  std::string code = generate_source(1 << 19) + "int $ = 1;\n" +
+                     generate_source(1 << 19) + "int # = 1;\n";
+  std::string expected;
+  try {
+    StringSource source(code);
+    Lexer(source).tokenize();
+  } catch (const LexerError& e) {
+    expected = e.what();
+  }
+  ASSERT_FALSE(expected.empty());
+
+  ThreadPool pool(4);
+  EXPECT_THROW(
+      {
+        try {
+          ParallelLexer(code, pool).tokenize();
+        } catch (const LexerError& e) {
+          EXPECT_EQ(e.what(), expected);
+          throw;
+        }
+      },
+      LexerError);
+}
@@ -0,0 +1,30 @@
+#include <functional>
+#include <sstream>
+
+#include "../interpreter/interpreter_utils.hpp"
+
+/**
+ * @brief Runs \p code before and after \p pass, expecting the same output or
+ * error.
+ *
+ * @return Result of the pass.
+ */
+inline static std::size_t expect_same_run(
+    const std::string& code, const std::function<std::size_t(Program&)>& pass) {
+  auto run = [](const Program& program) {
+    std::ostringstream out;
+    try {
+      Interpreter interpreter(out);
+      interpreter.visit(program);
+    } catch (const RuntimeError& e) {
+      out << "error: " << e.what();
+    }
+    return out.str();
+  };
+
+  auto program = get_ast(code);
+  auto expected = run(*program);
+  std::size_t changed = pass(*program);
+  EXPECT_EQ(run(*program), expected);
+  return changed;
+}
@@ -0,0 +1,112 @@
+#include "optimizer/dead_code.hpp"
+#include "optimizer/inliner.hpp"
+#include "optimizer_utils.hpp"
+
+TEST(DeadCodeTests, statements_after_return) {
+  std::string code = R"(
+    int sign(int v) {
+      if (v < 0) {
+        return -1;
+        print "negative";
+      } else {
+        if (v == 0) {
+          return 0;
+        }
+        print "positive";
+      }
+      print v;
+      {
+        return 1;
+      }
+      print "unreachable";
+      return 2;
+    }
+    int twice(int v) {
+      if (v > 10) {
+        return 2 * v;
+      } else {
+        return v + v;
+      }
+      print "unreachable";
+    }
+    print sign(0 - 5);
+    print sign(3);
+    print twice(sign(0));
+  )";
+
+  EXPECT_EQ(expect_same_run(code, remove_unreachable_statements), 4);
+}
+
+TEST(DeadCodeTests, unused_declarations) {
+  std::string code = R"(
+    struct Point {int x; int y;}
+    struct Unused {int a;}
+    struct Label {str text;}
+    variant Shape {int, Point};
+    variant Tag {Label};
+    int unused(Label label) {
+      return helper();
+    }
+    int helper() {
+      return 1;
+    }
+    int area(Shape shape) {
+      return helper() + (shape as int);
+    }
+    int recursive(int n) {
+      return recursive(n);
+    }
+    Shape s = 4;
+    print area(s);
+  )";
+
+  // Unused, Label, Tag, unused and recursive
+  EXPECT_EQ(expect_same_run(code, remove_unused_declarations), 5);
+}
+
+TEST(DeadCodeTests, failing_declarations_are_kept) {
+  std::string redefined = R"(
+    int f() { return 1; }
+    print 1;
+    int f() { return 2; }
+  )";
+  std::string repeated_param = R"(
+    print 1;
+    int f(int a, int a) { return a; }
+  )";
+  std::string unknown_type = R"(
+    print 1;
+    variant V {int, P};
+    struct P {int x;}
+  )";
+  std::string redefined_inside = R"(
+    struct P {int x;}
+    void f() {
+      struct P {int y;}
+    }
+    f();
+  )";
+
+  EXPECT_EQ(expect_same_run(redefined, remove_unused_declarations), 0);
+  EXPECT_EQ(expect_same_run(repeated_param, remove_unused_declarations), 0);
+  EXPECT_EQ(expect_same_run(unknown_type, remove_unused_declarations), 0);
+  EXPECT_EQ(expect_same_run(redefined_inside, remove_unused_declarations), 0);
+}
+
+TEST(DeadCodeTests, inlined_functions_are_unused) {
+  std::string code = R"(
+    int add(int a, int b) {
+      return a + b;
+    }
+    print add(1, 2);
+    int x = 3;
+    print add(x, x);
+  )";
+
+  EXPECT_EQ(expect_same_run(code,
+                            [](Program& program) {
+                              EXPECT_EQ(inline_calls(program), 2);
+                              return remove_unused_declarations(program);
+                            }),
+            1);
+}
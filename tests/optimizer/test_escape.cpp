@@ -0,0 +1,65 @@
+#include "optimizer/escape.hpp"
+#include "optimizer_utils.hpp"
+
+TEST(EscapeTests, declarations_and_assignments) {
+  std::string code = R"(
+    struct P {int x; int[] tags;}
+    variant V {int, float};
+    struct S {V value; P p;}
+    mut int[str] ages = {{"ann", 30}};
+    for (int i in 0..3) {
+      P p = {i, {i, i + 1}};
+      V v = i;
+      S s = {v, p};
+      ages = {{"bob", s.p.tags[1]}, {"eve", s.value as int}};
+      print ages["bob"] + ages["eve"];
+    }
+  )";
+
+  EXPECT_EQ(expect_same_run(code, find_local_lists), 8);
+}
+
+TEST(EscapeTests, lists_passed_to_functions_escape) {
+  std::string code = R"(
+    int sum(int[] values) {
+      mut int acc = 0;
+      for (int v in values) {
+        acc = acc + v;
+      }
+      return acc;
+    }
+    int[] first() {
+      return {1, 2};
+    }
+    print sum({3, 4}) + sum(first());
+  )";
+
+  EXPECT_EQ(expect_same_run(code, find_local_lists), 0);
+}
+
+TEST(EscapeTests, nested_lists_in_one_statement) {
+  std::string code = R"(
+    struct P {mut int x; int[] tags;}
+    mut P[] ps = {{1, {2, 3}}, {4, {}}};
+    P[][] grid = {{{5, {6}}}, ps};
+    ps[0].x = 7;
+    print grid[0][0].tags[0];
+    print grid[1][0].x;
+    print ps[0].x;
+  )";
+
+  EXPECT_EQ(expect_same_run(code, find_local_lists), 9);
+}
+
+TEST(EscapeTests, errors_match_allocated_lists) {
+  std::string code = R"(
+    struct P {int x; int y;}
+    for (int i in 0..2) {
+      P p = {i, i};
+      print p.x;
+    }
+    P q = {1};
+  )";
+
+  EXPECT_EQ(expect_same_run(code, find_local_lists), 2);
+}
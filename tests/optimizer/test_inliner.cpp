@@ -0,0 +1,136 @@
+#include "optimizer/inliner.hpp"
+#include "optimizer_utils.hpp"
+
+TEST(InlinerTests, inlines_expression_functions) {
+  std::string code = R"(
+    float avg(float a, float b) {
+      return (a + b) / 2.0;
+    }
+    bool between(int v, int lo, int hi) {
+      return v >= lo and v <= hi;
+    }
+    str greet(str name) {
+      return "hello " + name;
+    }
+    float x = 1.0;
+    print avg(x, 3.0);
+    for (int i in 0..20) {
+      if (between(i, 10, 12)) {
+        print greet("no. ") + (i as str);
+      }
+    }
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 3);
+}
+
+TEST(InlinerTests, arguments_named_after_parameters) {
+  std::string code = R"(
+    int diff(int a, int b) {
+      return a - b;
+    }
+    int a = 5;
+    int b = 1;
+    print diff(b, a);
+    print diff(a + 1, b);
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 2);
+}
+
+TEST(InlinerTests, skips_functions_not_returning_expression) {
+  std::string code = R"(
+    int fact(int n) {
+      if (n < 2) {
+        return 1;
+      }
+      return n * fact(n - 1);
+    }
+    int twice(int n) {
+      return fact(n) * 2;
+    }
+    int first(int a, int b) {
+      return a + 0;
+    }
+    mut int counter = 3;
+    int offset(int n) {
+      return n + counter;
+    }
+    int same(int n) {
+      return (n);
+    }
+    print fact(5) + twice(3) + first(1, 2) + offset(1) + same(4);
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 0);
+}
+
+TEST(InlinerTests, skips_arguments_of_unknown_type) {
+  std::string code = R"(
+    int sq(int x) {
+      return x * x;
+    }
+    int[] values = {1, 2};
+    float f = 2.0;
+    int n = 3;
+    void show() {
+      print sq(n);
+    }
+    print sq(values[0]);
+    print sq(n + 1);
+    show();
+    print sq(f);
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 0);
+}
+
+TEST(InlinerTests, calls_before_definition_are_kept) {
+  std::string code = R"(
+    print sq(2);
+    int sq(int x) {
+      return x * x;
+    }
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 0);
+}
+
+TEST(InlinerTests, inlined_errors_match_calls) {
+  std::string code = R"(
+    int div(int a, int b) {
+      return a / b;
+    }
+    int zero = 0;
+    print div(1, 2);
+    print div(1, zero);
+  )";
+
+  EXPECT_EQ(expect_same_run(code, inline_calls), 2);
+}
+
+TEST(InlinerTests, arguments_evaluated_in_order_of_call) {
+  std::string swapped = R"(
+    int f(int a, int b) {
+      return b + a;
+    }
+    print f(1 / 0, 2147483647 + 1);
+  )";
+  std::string after_failing = R"(
+    int f(int a, int b) {
+      return a / 0 + b;
+    }
+    print f(1, 2147483647 + 1);
+  )";
+  std::string in_order = R"(
+    bool f(int a, int b, int c) {
+      return c > 0 and a < b;
+    }
+    int x = 1;
+    print f(x + 1, x * 2, x - 1);
+  )";
+
+  EXPECT_EQ(expect_same_run(swapped, inline_calls), 0);
+  EXPECT_EQ(expect_same_run(after_failing, inline_calls), 0);
+  EXPECT_EQ(expect_same_run(in_order, inline_calls), 1);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "lexer/lexer.hpp"
+#include "parser/incremental_parser.hpp"
+#include "parser/parser.hpp"
+#include "serializer/serializer.hpp"
+
+static std::string serialize_parsed(const std::string& code) {
+  StringSource source(code);
+  auto program = Parser(Lexer(source).tokenize()).parse();
+  return ASTSerializer::serialize(*program, 0);
+}
+
+static void expect_reparsed(IncrementalParser& parser, Program& program,
+                            const std::string& find,
+                            const std::string& replacement) {
+  std::size_t offset = parser.text().find(find);
+  ASSERT_NE(offset, std::string::npos);
+  parser.reparse(program, {offset, find.size(), replacement});
+  EXPECT_EQ(ASTSerializer::serialize(program, 0),
+            serialize_parsed(parser.text()));
+}
+
+static const std::string CODE = R"(int f(int a) {
+  if (a > 1) { return a; }
+  return 0;
+}
+struct S { int a; mut float b; }
+if (f(1) == 0) print 1; else { print 2; }
+S s = {1, 2.5}; print s.a; /* note */
+mut int i = 0;
+while (i < 10) {
+  i = i + 1;
+}
+print i;
+)";
+
+TEST(IncrementalParserTest, matches_full_parse_after_edits) {
+  IncrementalParser parser(CODE);
+  auto program = parser.parse();
+  EXPECT_EQ(ASTSerializer::serialize(*program, 0), serialize_parsed(CODE));
+
+  expect_reparsed(parser, *program, "return 0;", "return a * 2;");
+  expect_reparsed(parser, *program, "2.5}; print", "2.5};\n\nprint");
+  expect_reparsed(parser, *program, "print 1;", "{ print 1; print 0; }");
+  expect_reparsed(parser, *program, "i = i + 1;\n", "");
+  expect_reparsed(parser, *program, "print i;\n", "print i;\nprint f(i);\n");
+  expect_reparsed(parser, *program, "int f",
+                  "int g(int b) { return b; }\nint f");
+  expect_reparsed(parser, *program, "} else", "}\nelse");
+}
+
+TEST(IncrementalParserTest, edits_spanning_statements) {
+  IncrementalParser parser(CODE);
+  auto program = parser.parse();
+
+  expect_reparsed(parser, *program, "struct S", "print 3; struct S");
+  expect_reparsed(parser, *program, "a; mut float b; }\nif", "a; }\nif");
+  expect_reparsed(parser, *program, "}\nif (f(1)", "} print 4;\nif (f(1)");
+  expect_reparsed(parser, *program, "mut int i = 0;", "");
+  expect_reparsed(parser, *program, "print i;", "mut int i = 0; print i;");
+}
+
+TEST(IncrementalParserTest, comments_spanning_statements) {
+  IncrementalParser parser(CODE);
+  auto program = parser.parse();
+
+  expect_reparsed(parser, *program, "struct S", "/* struct S");
+  expect_reparsed(parser, *program, "/* struct S", "struct S");
+  expect_reparsed(parser, *program, "S s =", "// S s =");
+  expect_reparsed(parser, *program, "// S s =", "S s =");
+  expect_reparsed(parser, *program, "note */", "note\nprint 5; */");
+  EXPECT_EQ(program->statements.size(), 8);
+  expect_reparsed(parser, *program, "note\nprint 5; */", "note */\nprint 5;");
+  EXPECT_EQ(program->statements.size(), 9);
+}
+
+TEST(IncrementalParserTest, error_leaves_program_unchanged) {
+  IncrementalParser parser(CODE);
+  auto program = parser.parse();
+  std::string before = ASTSerializer::serialize(*program, 0);
+
+  std::size_t offset = CODE.find("print i;");
+  EXPECT_THROW(parser.reparse(*program, {offset, 8, "print ;"}), SyntaxError);
+  EXPECT_THROW(parser.reparse(*program, {offset, 0, "\"abc"}), LexerError);
+  EXPECT_THROW(parser.reparse(*program, {CODE.size() + 1, 0, ""}),
+               std::out_of_range);
+  EXPECT_EQ(parser.text(), CODE);
+  EXPECT_EQ(ASTSerializer::serialize(*program, 0), before);
+
+  expect_reparsed(parser, *program, "print i;", "print i + 1;");
+}
+
+TEST(IncrementalParserTest, empty_source) {
+  IncrementalParser parser("");
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 0);
+
+  parser.reparse(*program, {0, 0, "print 1;\r\nprint 2;"});
+  EXPECT_EQ(parser.text(), "print 1;\nprint 2;");
+  EXPECT_EQ(program->statements.size(), 2);
+  expect_reparsed(parser, *program, "print 1;\nprint 2;", "");
+  EXPECT_EQ(program->statements.size(), 0);
+}
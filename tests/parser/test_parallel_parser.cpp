@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "../utils.hpp"
+#include "lexer/lexer.hpp"
+#include "parser/parallel_parser.hpp"
+#include "parser/parser.hpp"
+#include "serializer/serializer.hpp"
+
+static std::string generate_program(int statements) {
+  std::string code;
+  for (int i = 0; i < statements; ++i) {
+    std::string n = std::to_string(i);
+    code += "struct S" + n + " { int a; mut float b; }\n";
+    code += "variant V" + n + " { int, S" + n + " };\n";
+    code += "int f" + n + "(int a) { if (a > 1) { return a; } return 0; }\n";
+    code += "if (f" + n + "(1) == 0) print 1; else if (true) { print 2; }" +
+            " else print 3;\n";
+    code += "S" + n + " s" + n + " = {1, 2.5};\n";
+    code += "while (false) {}\n";
+  }
+  return code;
+}
+
+static std::vector<Token> tokenize(const std::string& code) {
+  StringSource source(code);
+  return Lexer(source).tokenize();
+}
+
+TEST(ParallelParserTest, matches_sequential_parser) {
+  std::string code = generate_program(2000);
+  auto expected = Parser(tokenize(code)).parse();
+  ThreadPool pool(4);
+  auto program = ParallelParser(tokenize(code), pool).parse();
+
+  EXPECT_EQ(program->statements.size(), expected->statements.size());
+  EXPECT_EQ(ASTSerializer::serialize(*program, 0),
+            ASTSerializer::serialize(*expected, 0));
+}
+
+TEST(ParallelParserTest, small_program) {
+  ThreadPool pool(4);
+  auto program = ParallelParser(tokenize("print 1;"), pool).parse();
+  EXPECT_EQ(program->statements.size(), 1);
+  EXPECT_EQ(ParallelParser({}, pool).parse()->statements.size(), 0);
+}
+
+TEST(ParallelParserTest, reports_earliest_error) {
+  std::string code = generate_program(500) + "int a = ;\n" +
+                     generate_program(500) + "print 1\n" +
+                     generate_program(500);
+  ThreadPool pool(4);
+  EXPECT_THROW(
+      {
+        try {
+          ParallelParser(tokenize(code), pool).parse();
+        } catch (const SyntaxError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Expected expression."));
+          EXPECT_EQ(e.get_token().get_position().line, 3001);
+          throw;
+        }
+      },
+      SyntaxError);
+}
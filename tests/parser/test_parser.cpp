@@ -21,6 +21,24 @@ TEST(ParserErrorTest, missing_semicolon) {
       SyntaxError);
 }
 
+TEST(ParserErrorTest, range_loop_variable_not_int) {
+  StringSource source("for (float x in 0..2) {}");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  EXPECT_THROW(
+      {
+        try {
+          parser.parse();
+        } catch (const SyntaxError& e) {
+          EXPECT_TRUE(str_contains(
+              e.what(), "Expected int loop variable in range loop."));
+          EXPECT_EQ(e.get_token().get_type(), TokenType::TOKEN_DOT_DOT);
+          throw;
+        }
+      },
+      SyntaxError);
+}
+
 TEST(ParserErrorTest, missing_semicolon_2) {
   StringSource source("a = 2");
   Lexer lexer(source);
@@ -602,6 +620,54 @@ TEST(ParserLogicalExprTest, print_or) {
   EXPECT_TRUE(logical_expr != nullptr);
 }
 
+TEST(ParserBinaryExprTest, precedence_and_associativity) {
+  StringSource source("print a - b - c * d < e or f and !g == h;");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 1);
+
+  auto print_stmt = dynamic_cast<PrintStmt*>(program->statements[0].get());
+  EXPECT_TRUE(print_stmt != nullptr);
+
+  auto or_expr = dynamic_cast<LogicalOrExpr*>(print_stmt->expr.get());
+  EXPECT_TRUE(or_expr != nullptr);
+
+  auto less_expr = dynamic_cast<LessCompExpr*>(or_expr->left.get());
+  EXPECT_TRUE(less_expr != nullptr);
+  auto outer_sub = dynamic_cast<SubtractionExpr*>(less_expr->left.get());
+  EXPECT_TRUE(outer_sub != nullptr);
+  auto inner_sub = dynamic_cast<SubtractionExpr*>(outer_sub->left.get());
+  EXPECT_TRUE(inner_sub != nullptr);
+  EXPECT_EQ(dynamic_cast<VarExpr*>(inner_sub->left.get())->identifier, "a");
+  EXPECT_TRUE(dynamic_cast<MultiplicationExpr*>(outer_sub->right.get()) !=
+              nullptr);
+
+  auto and_expr = dynamic_cast<LogicalAndExpr*>(or_expr->right.get());
+  EXPECT_TRUE(and_expr != nullptr);
+  auto equal_expr = dynamic_cast<EqualCompExpr*>(and_expr->right.get());
+  EXPECT_TRUE(equal_expr != nullptr);
+  EXPECT_TRUE(dynamic_cast<LogicalNegationExpr*>(equal_expr->left.get()) !=
+              nullptr);
+}
+
+TEST(ParserErrorTest, binary_missing_right_operand) {
+  StringSource source("print 1 + * 2;");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  EXPECT_THROW(
+      {
+        try {
+          parser.parse();
+        } catch (const SyntaxError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Expected expression."));
+          EXPECT_EQ(e.get_token().get_position().column, 11);
+          throw;
+        }
+      },
+      SyntaxError);
+}
+
 TEST(ParserTest, block_stmt) {
   StringSource source("{print \"Hello World\";}");
   Lexer lexer(source);
@@ -856,3 +922,119 @@ TEST(ParserTest, func_decl_stmt) {
   EXPECT_EQ(body->statements.size(), 1);
   EXPECT_TRUE(dynamic_cast<PrintStmt*>(body->statements[0].get()) != nullptr);
 }
+
+TEST(ParserTest, array_decl_stmt) {
+  StringSource source("mut S[][] a = {{}, {b}};");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 1);
+
+  auto var_stmt = dynamic_cast<VarDeclStmt*>(program->statements[0].get());
+  ASSERT_TRUE(var_stmt != nullptr);
+  EXPECT_TRUE(var_stmt->mut);
+  EXPECT_EQ(var_stmt->type.type, ARRAY);
+  EXPECT_EQ(var_stmt->type.element->type, ARRAY);
+  EXPECT_EQ(var_stmt->type.element->element->name, "S");
+
+  auto list = dynamic_cast<InitalizerListExpr*>(var_stmt->initializer.get());
+  ASSERT_TRUE(list != nullptr);
+  EXPECT_EQ(list->list.size(), 2);
+  auto empty = dynamic_cast<InitalizerListExpr*>(list->list[0].get());
+  ASSERT_TRUE(empty != nullptr);
+  EXPECT_EQ(empty->list.size(), 0);
+}
+
+TEST(ParserTest, map_decl_stmt) {
+  StringSource source("S[][str] a = {}; a[str_key] = {};");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 2);
+
+  auto var_stmt = dynamic_cast<VarDeclStmt*>(program->statements[0].get());
+  ASSERT_TRUE(var_stmt != nullptr);
+  EXPECT_EQ(var_stmt->type.type, MAP);
+  EXPECT_EQ(var_stmt->type.key->type, STR);
+  EXPECT_EQ(var_stmt->type.element->type, ARRAY);
+  EXPECT_EQ(var_stmt->type.element->element->name, "S");
+
+  EXPECT_TRUE(dynamic_cast<AssignStmt*>(program->statements[1].get()) !=
+              nullptr);
+}
+
+TEST(ParserTest, index_assign_stmt) {
+  StringSource source("a[i].b[0] = a[1];");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 1);
+
+  auto assign_stmt = dynamic_cast<AssignStmt*>(program->statements[0].get());
+  ASSERT_TRUE(assign_stmt != nullptr);
+  auto index = dynamic_cast<IndexExpr*>(assign_stmt->var.get());
+  ASSERT_TRUE(index != nullptr);
+  EXPECT_TRUE(dynamic_cast<LiteralExpr*>(index->index.get()) != nullptr);
+  auto field = dynamic_cast<FieldAccessExpr*>(index->array.get());
+  ASSERT_TRUE(field != nullptr);
+  EXPECT_EQ(field->field_name, "b");
+  EXPECT_TRUE(dynamic_cast<IndexExpr*>(field->parent_struct.get()) != nullptr);
+  EXPECT_TRUE(dynamic_cast<IndexExpr*>(assign_stmt->value.get()) != nullptr);
+}
+
+TEST(ParserTest, for_stmt) {
+  StringSource source("for (int x in a) print x;");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 1);
+
+  auto for_stmt = dynamic_cast<ForStmt*>(program->statements[0].get());
+  ASSERT_TRUE(for_stmt != nullptr);
+  EXPECT_EQ(for_stmt->type.type, INT);
+  EXPECT_EQ(for_stmt->identifier, "x");
+  EXPECT_TRUE(dynamic_cast<VarExpr*>(for_stmt->iterable.get()) != nullptr);
+  EXPECT_TRUE(dynamic_cast<PrintStmt*>(for_stmt->body.get()) != nullptr);
+}
+
+TEST(ParserTest, for_range_stmt) {
+  StringSource source("for (int i in 0..size(a)) {}");
+  Lexer lexer(source);
+  Parser parser(lexer);
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 1);
+
+  auto for_stmt = dynamic_cast<ForRangeStmt*>(program->statements[0].get());
+  ASSERT_TRUE(for_stmt != nullptr);
+  EXPECT_EQ(for_stmt->identifier, "i");
+  EXPECT_TRUE(dynamic_cast<LiteralExpr*>(for_stmt->begin.get()) != nullptr);
+  EXPECT_TRUE(dynamic_cast<CallExpr*>(for_stmt->end.get()) != nullptr);
+  EXPECT_TRUE(dynamic_cast<BlockStmt*>(for_stmt->body.get()) != nullptr);
+}
+
+TEST(ParserTest, pre_lexed_tokens) {
+  StringSource source("int a = 1; // comment\nprint a;");
+  Parser parser(Lexer(source).tokenize());
+  auto program = parser.parse();
+  EXPECT_EQ(program->statements.size(), 2);
+  EXPECT_TRUE(dynamic_cast<VarDeclStmt*>(program->statements[0].get()) !=
+              nullptr);
+  EXPECT_TRUE(dynamic_cast<PrintStmt*>(program->statements[1].get()) !=
+              nullptr);
+}
+
+TEST(ParserErrorTest, pre_lexed_tokens_error) {
+  StringSource source("a = 2");
+  Parser parser(Lexer(source).tokenize());
+  EXPECT_THROW(
+      {
+        try {
+          parser.parse();
+        } catch (const SyntaxError& e) {
+          EXPECT_TRUE(str_contains(e.what(), "Expected ';' after assignment."));
+          EXPECT_EQ(e.get_token().get_type(), TokenType::TOKEN_ETX);
+          throw;
+        }
+      },
+      SyntaxError);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "../interpreter/interpreter_utils.hpp"
+#include "serializer/cache.hpp"
+#include "serializer/serializer.hpp"
+
+static const std::string CODE = R"(
+  struct Point {
+    int x;
+    mut float y;
+  }
+  variant Number {int, float, Point};
+
+  int add(int a, int b) {
+    return a + b;
+  }
+
+  void describe(Number n) {
+    inspect n {
+      int i => { print "int " + (i as str); }
+      Point p => { print p.y; }
+      default => { print "other"; }
+    }
+  }
+
+  mut int i = 0;
+  mut str s = "";
+  while (i < 3 and !false) {
+    if (i == 1) {
+      s = s + "one";
+    } else {
+      s = s + "x";
+    }
+    i = add(i, 1);
+  }
+  print s;
+  print (0 - 1234567) / 3 * 2.5 as int;
+  print 3.25 is float;
+  Point p = {1, 2.5};
+  mut Number n = p;
+  describe(n);
+  n = 7;
+  describe(n);
+  n = 1.5;
+  describe(n);
+  mut Point[][] grid = {{p}, {}};
+  push(grid[1], {3, 4.5});
+  grid[0][0] = grid[1][0];
+  for (Point[] row in grid) {
+    print size(row);
+    for (Point q in row) { print q.x; }
+  }
+  mut Point[str] named = {{"p", p}};
+  named["q"] = grid[1][0];
+  for (str name in named) { print named[name].y; }
+  for (int k in 1..i + 1) { print k; }
+)";
+
+TEST(SerializerTests, round_trip_is_byte_identical) {
+  auto program = get_ast(CODE);
+  std::string data = ASTSerializer::serialize(*program, 42);
+  auto restored = ASTDeserializer::deserialize(data, 42);
+  ASSERT_NE(restored, nullptr);
+  EXPECT_EQ(ASTSerializer::serialize(*restored, 42), data);
+}
+
+TEST(SerializerTests, restored_program_interprets_identically) {
+  auto program = get_ast(CODE);
+  auto restored =
+      ASTDeserializer::deserialize(ASTSerializer::serialize(*program, 0), 0);
+  ASSERT_NE(restored, nullptr);
+  std::string expected = capture_interpreted_stdout(CODE);
+
+  testing::internal::CaptureStdout();
+  Interpreter().visit(*restored);
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), expected);
+}
+
+TEST(SerializerTests, stale_data_is_rejected) {
+  auto program = get_ast(CODE);
+  std::string data = ASTSerializer::serialize(*program, 1);
+  EXPECT_EQ(ASTDeserializer::deserialize(data, 2), nullptr);
+  EXPECT_EQ(ASTDeserializer::deserialize("", 1), nullptr);
+  EXPECT_EQ(ASTDeserializer::deserialize("not a cache", 1), nullptr);
+}
+
+TEST(SerializerTests, truncated_data_throws) {
+  auto program = get_ast(CODE);
+  std::string data = ASTSerializer::serialize(*program, 1);
+  data.resize(data.size() / 2);
+  EXPECT_THROW(ASTDeserializer::deserialize(data, 1), SerializationError);
+}
+
+TEST(SerializerTests, missing_required_node_throws) {
+  // Same bytes as a cache whose print expression tag got zeroed.
+  std::vector<std::unique_ptr<Stmt>> statements;
+  statements.push_back(std::make_unique<PrintStmt>(nullptr, Position{1, 1}));
+  Program program(std::move(statements), Position{1, 1});
+  std::string data = ASTSerializer::serialize(program, 1);
+  EXPECT_THROW(ASTDeserializer::deserialize(data, 1), SerializationError);
+}
+
+TEST(SerializerTests, missing_optional_nodes_round_trip) {
+  auto program = get_ast(R"(
+    void f() { return; }
+    if (true) { f(); }
+  )");
+  std::string data = ASTSerializer::serialize(*program, 1);
+  auto restored = ASTDeserializer::deserialize(data, 1);
+  ASSERT_NE(restored, nullptr);
+  EXPECT_EQ(ASTSerializer::serialize(*restored, 1), data);
+}
+
+TEST(SerializerTests, cache_file_round_trip) {
+  // concurrent test runs must not share the file
+  std::string path =
+      std::filesystem::temp_directory_path() /
+      ("boalang_test_cache_" + std::to_string(getpid()) + ".boac");
+  std::uint64_t hash = hash_source(CODE);
+  auto program = get_ast(CODE);
+
+  ASSERT_TRUE(store_cached_program(path, *program, hash));
+  auto cached = load_cached_program(path, hash);
+  ASSERT_NE(cached, nullptr);
+  EXPECT_EQ(ASTSerializer::serialize(*cached, hash),
+            ASTSerializer::serialize(*program, hash));
+  EXPECT_EQ(load_cached_program(path, hash_source(CODE + " ")), nullptr);
+
+  std::remove(path.c_str());
+  EXPECT_EQ(load_cached_program(path, hash), nullptr);
+}
+
+TEST(SerializerTests, cache_path_replaces_extension) {
+  EXPECT_EQ(cache_path("dir/script.boa"), "dir/script.boac");
+  EXPECT_EQ(cache_path("script"), "script.boac");
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "source/scan.hpp"
+
+class ScanKernelsTest : public testing::TestWithParam<ScanLevel> {};
+
+TEST_P(ScanKernelsTest, matches_scalar) {
+  const ScanKernels& scalar = scan_kernels(ScanLevel::SCALAR);
+  const ScanKernels& kernels = scan_kernels(GetParam());
+  const std::string alphabet = " \t\n\v\f\r*/\"ab";
+  std::mt19937 rng(GetParam() == ScanLevel::AVX2 ? 2 : 1);
+
+  for (std::size_t length = 0; length < 100; ++length) {
+    std::string text;
+    for (std::size_t i = 0; i < length; ++i) {
+      // mostly whitespace, so that long runs are produced
+      text += alphabet[rng() % (rng() % 4 ? 6 : alphabet.size())];
+    }
+    EXPECT_EQ(kernels.find_non_whitespace(text),
+              scalar.find_non_whitespace(text));
+    EXPECT_EQ(kernels.find_char(text, '\n'), scalar.find_char(text, '\n'));
+    EXPECT_EQ(kernels.find_either(text, '"', '\n'),
+              scalar.find_either(text, '"', '\n'));
+    EXPECT_EQ(kernels.count_char(text, '\n'), scalar.count_char(text, '\n'));
+  }
+}
+
+TEST_P(ScanKernelsTest, not_found_returns_size) {
+  const ScanKernels& kernels = scan_kernels(GetParam());
+  std::string spaces(70, ' ');
+  EXPECT_EQ(kernels.find_non_whitespace(spaces), spaces.size());
+  EXPECT_EQ(kernels.find_char(spaces, '*'), spaces.size());
+  EXPECT_EQ(kernels.find_either(spaces, '"', '\n'), spaces.size());
+  EXPECT_EQ(kernels.count_char(spaces, '\n'), 0);
+  EXPECT_EQ(kernels.find_char("", '*'), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ScanLevels, ScanKernelsTest,
+                         testing::Values(ScanLevel::SCALAR, ScanLevel::SSE2,
+                                         ScanLevel::AVX2));
@@ -81,3 +81,26 @@ TEST(StringSourceTest, crlf_to_lf) {
 
   EXPECT_EQ(source.next(), '\0');
 }
+
+TEST(StringSourceTest, skip_matches_next) {
+  const std::string text = "ab\n\ncd\r\ne\nfgh  \n";
+  for (std::size_t start = 0; start <= 3; ++start) {
+    for (std::size_t count = 0; count + start <= 13; ++count) {
+      StringSource expected(text);
+      StringSource skipped(text);
+      for (std::size_t i = 0; i < start; ++i) {
+        expected.next();
+        skipped.next();
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        expected.next();
+      }
+      skipped.skip(count);
+
+      EXPECT_EQ(skipped.current(), expected.current());
+      EXPECT_EQ(skipped.peek(), expected.peek());
+      EXPECT_EQ(skipped.get_position().line, expected.get_position().line);
+      EXPECT_EQ(skipped.get_position().column, expected.get_position().column);
+    }
+  }
+}